@@ -52,7 +52,7 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         TabMeta &tab = sm_manager_->db_.get_table(x->tab_name);
         for (auto &set_clause : query->set_clauses) {
             auto lhs_col = tab.get_col(set_clause.lhs.col_name);
-            if (lhs_col->type != set_clause.rhs.type) {
+            if (!is_compatible_type(lhs_col->type, set_clause.rhs.type)) {
                 throw IncompatibleTypeError(coltype2str(lhs_col->type), coltype2str(set_clause.rhs.type));
             }
             set_clause.rhs.init_raw(lhs_col->len);
@@ -65,10 +65,27 @@ std::shared_ptr<Query> Analyze::do_analyze(std::shared_ptr<ast::TreeNode> parse)
         get_clause(x->conds, query->conds);
         check_clause({x->tab_name}, query->conds);        
     } else if (auto x = std::dynamic_pointer_cast<ast::InsertStmt>(parse)) {
-        // 处理insert 的values值
-        for (auto &sv_val : x->vals) {
-            query->values.push_back(convert_sv_value(sv_val));
+        // 处理insert 的values值，每个括号对应一行
+        for (auto &sv_row : x->rows) {
+            std::vector<Value> row;
+            for (auto &sv_val : sv_row) {
+                row.push_back(convert_sv_value(sv_val));
+            }
+            query->rows.push_back(std::move(row));
+        }
+    } else if (auto x = std::dynamic_pointer_cast<ast::LoadData>(parse)) {
+        // 检查导入的表是否存在
+        if (!sm_manager_->db_.is_table(x->tab_name)) {
+            throw TableNotFoundError(x->tab_name);
+        }
+    } else if (auto x = std::dynamic_pointer_cast<ast::Vacuum>(parse)) {
+        // 检查整理的表是否存在
+        if (!sm_manager_->db_.is_table(x->tab_name)) {
+            throw TableNotFoundError(x->tab_name);
         }
+    } else if (auto x = std::dynamic_pointer_cast<ast::SetKnob>(parse)) {
+        // 处理set语句的参数值
+        query->values.push_back(convert_sv_value(x->val));
     } else {
         // do nothing
     }
@@ -151,7 +168,7 @@ void Analyze::check_clause(const std::vector<std::string> &tab_names, std::vecto
             auto rhs_col = rhs_tab.get_col(cond.rhs_col.col_name);
             rhs_type = rhs_col->type;
         }
-        if (lhs_type != rhs_type) {
+        if (!is_compatible_type(lhs_type, rhs_type)) {
             throw IncompatibleTypeError(coltype2str(lhs_type), coltype2str(rhs_type));
         }
     }
@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <string>
 
 #define BUFFER_LENGTH 8192
 
@@ -34,6 +35,24 @@ static constexpr int HEADER_PAGE_ID = 0;                                      //
 static constexpr int PAGE_SIZE = 4096;                                        // size of a data page in byte  4KB
 static constexpr int BUFFER_POOL_SIZE = 65536;                                // size of buffer pool 256MB
 // static constexpr int BUFFER_POOL_SIZE = 262144;                                // size of buffer pool 1GB
+static constexpr int BUFFER_POOL_INSTANCES = 8;                               // number of buffer pool partitions
+static constexpr bool BUFFER_POOL_HUGE_PAGES = false;                         // back the buffer pool data arena with 2MB huge pages when available
+static constexpr int BUFFER_POOL_CHUNK_SIZE = 1024;                           // frames per buffer pool chunk, the granularity of online resize 4MB
+static constexpr int BUFFER_POOL_MAX_CHUNKS = 8192;                           // max chunks per buffer pool partition
+static constexpr int BUFFER_POOL_RESIZE_RETRIES = 100;                        // 1ms retries while a chunk being shrunk still has pinned pages
+static constexpr bool DIRECT_IO = false;                                      // open table and index files with O_DIRECT to bypass the kernel page cache
+static constexpr int PAGE_DESC_ALIGN = 32;                                    // frame descriptors are packed two per 64B cache line
+static constexpr int PAGE_TABLE_SPIN_LIMIT = 64;                              // pause-spins of a page table lookup waiting for a writer before yielding
+static constexpr int SCAN_RING_SIZE = 32;                                     // frames in a large seq scan's private buffer ring 128KB
+static constexpr int SCAN_RING_THRESHOLD_DIVISOR = 4;                         // seq scans over tables larger than pool_size / 4 use a ring
+static constexpr int PREFETCH_DISTANCE = 16;                                  // pages read ahead by RmScan / leaves read ahead by IxScan
+static constexpr int IO_WORKER_THREADS = 4;                                   // background threads serving buffer pool prefetch
+static constexpr int ASYNC_IO_QUEUE_DEPTH = 256;                              // io_uring submission queue entries
+static constexpr int FLUSH_MAX_RUN_PAGES = 64;                                // adjacent dirty pages coalesced into one pwritev by flush_all_pages 256KB
+static constexpr int FLUSH_BATCH_PAGES = 1024;                                // dirty pages copied out under their latches per flush_all_pages batch 4MB
+static constexpr int BG_FLUSH_INTERVAL_MS = 100;                              // background flusher wakes up every 100ms
+static constexpr int BG_FLUSH_RATE = 2000;                                    // default max pages per second written by the background flusher, 0 disables it
+static constexpr double BG_FLUSH_CLEAN_RATIO = 0.1;                           // default fraction of frames at the replacer tail kept clean
 static constexpr int LOG_BUFFER_SIZE = (1024 * PAGE_SIZE);                    // size of a log buffer in byte
 static constexpr int BUCKET_SIZE = 50;                                        // size of extendible hash bucket
 
@@ -49,6 +68,16 @@ using timestamp_t = int32_t;  // timestamp type, used for transaction concurrenc
 static const std::string LOG_FILE_NAME = "db.log";
 
 // replacer
-static const std::string REPLACER_TYPE = "LRU";
+static const std::string REPLACER_TYPE = "LRU-K";   // "LRU", "CLOCK" or "LRU-K"
+static constexpr size_t LRU_K_REPLACER_K = 2;       // k used by the LRU-K replacer
 
 static const std::string DB_META_NAME = "db.meta";
+
+// buffer pool warm-up
+static const std::string BUFFER_POOL_DUMP_NAME = "buffer_pool.dump";   // resident pages saved at close_db and reloaded at open_db
+static constexpr int BUFFER_POOL_DUMP_INTERVAL_SEC = 60;                // also saved periodically while the db is open, 0 disables
+
+// I/O statistics
+static constexpr int IO_STATS_STRIPES = 16;                             // per-thread stripes of the I/O counters, power of two
+static const std::string METRICS_FILE_NAME = "metrics.log";             // I/O statistics appended periodically while the db is open
+static constexpr int METRICS_DUMP_INTERVAL_SEC = 10;                    // 0 disables the periodic metrics dump
@@ -40,18 +40,27 @@ struct Rid {
 };
 
 enum ColType {
-    TYPE_INT, TYPE_FLOAT, TYPE_STRING
+    TYPE_INT, TYPE_FLOAT, TYPE_STRING, TYPE_VARCHAR
 };
 
 inline std::string coltype2str(ColType type) {
     std::map<ColType, std::string> m = {
             {TYPE_INT,    "INT"},
             {TYPE_FLOAT,  "FLOAT"},
-            {TYPE_STRING, "STRING"}
+            {TYPE_STRING, "STRING"},
+            {TYPE_VARCHAR, "VARCHAR"}
     };
     return m.at(type);
 }
 
+// CHAR和VARCHAR在内存中的记录格式相同，都按最大长度存储、末尾补0，只是VARCHAR在slotted格式的页面中按实际长度存储
+inline bool is_string_type(ColType type) { return type == TYPE_STRING || type == TYPE_VARCHAR; }
+
+// 字符串常量可以赋值给CHAR和VARCHAR字段，CHAR和VARCHAR字段之间也可以比较
+inline bool is_compatible_type(ColType lhs, ColType rhs) {
+    return lhs == rhs || (is_string_type(lhs) && is_string_type(rhs));
+}
+
 class RecScan {
 public:
     virtual ~RecScan() = default;
@@ -71,6 +71,18 @@ class InvalidRecordSizeError : public RMDBError {
     InvalidRecordSizeError(int record_size) : RMDBError("Invalid record size: " + std::to_string(record_size)) {}
 };
 
+class UnknownStorageFormatError : public RMDBError {
+   public:
+    UnknownStorageFormatError(const std::string &format) : RMDBError("Unknown storage format: " + format) {}
+};
+
+class TooManyColumnsError : public RMDBError {
+   public:
+    TooManyColumnsError(const std::string &format, int num_cols, int max_cols)
+        : RMDBError("Storage format " + format + " supports at most " + std::to_string(max_cols) +
+                    " columns, got " + std::to_string(num_cols)) {}
+};
+
 // IX errors
 class InvalidColLengthError : public RMDBError {
    public:
@@ -149,6 +161,24 @@ class IncompatibleTypeError : public RMDBError {
         : RMDBError("Incompatible type error: lhs " + lhs + ", rhs " + rhs) {}
 };
 
+class LoadDataError : public RMDBError {
+   public:
+    LoadDataError(const std::string &file_name, int line, const std::string &reason)
+        : RMDBError("Failed to load " + file_name + " at line " + std::to_string(line) + ": " + reason) {}
+};
+
+class LoadIndexedTableError : public RMDBError {
+   public:
+    LoadIndexedTableError(const std::string &tab_name)
+        : RMDBError("LOAD DATA does not support tables with indexes: " + tab_name) {}
+};
+
+class VacuumIndexedTableError : public RMDBError {
+   public:
+    VacuumIndexedTableError(const std::string &tab_name)
+        : RMDBError("VACUUM does not support tables with indexes: " + tab_name) {}
+};
+
 class AmbiguousColumnError : public RMDBError {
    public:
     AmbiguousColumnError(const std::string &col_name) : RMDBError("Ambiguous column: " + col_name) {}
@@ -158,4 +188,15 @@ class PageNotExistError : public RMDBError {
    public:
     PageNotExistError(const std::string &table_name, int page_no)
         : RMDBError("Page " + std::to_string(page_no) + " in table " + table_name + "not exits") {}
-};
\ No newline at end of file
+};
+
+class UnknownKnobError : public RMDBError {
+   public:
+    UnknownKnobError(const std::string &knob_name) : RMDBError("Unknown setting: " + knob_name) {}
+};
+
+class InvalidKnobValueError : public RMDBError {
+   public:
+    InvalidKnobValueError(const std::string &knob_name, const std::string &reason)
+        : RMDBError("Invalid value for setting " + knob_name + ": " + reason) {}
+};
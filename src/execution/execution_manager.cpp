@@ -23,16 +23,23 @@ See the Mulan PSL v2 for more details. */
 const char *help_info = "Supported SQL syntax:\n"
                    "  command ;\n"
                    "command:\n"
-                   "  CREATE TABLE table_name (column_name type [, column_name type ...])\n"
+                   "  CREATE TABLE table_name (column_name type [, column_name type ...]) [STORAGE = storage_format]\n"
                    "  DROP TABLE table_name\n"
                    "  CREATE INDEX table_name (column_name)\n"
                    "  DROP INDEX table_name (column_name)\n"
-                   "  INSERT INTO table_name VALUES (value [, value ...])\n"
+                   "  INSERT INTO table_name VALUES (value [, value ...]) [, (value [, value ...]) ...]\n"
+                   "  LOAD DATA 'file_name' INTO table_name\n"
                    "  DELETE FROM table_name [WHERE where_clause]\n"
                    "  UPDATE table_name SET column_name = value [, column_name = value ...] [WHERE where_clause]\n"
                    "  SELECT selector FROM table_name [WHERE where_clause]\n"
+                   "  SET setting_name = value\n"
+                   "  CHECKPOINT\n"
+                   "  SHOW BUFFER STATUS\n"
+                   "  VACUUM table_name\n"
                    "type:\n"
-                   "  {INT | FLOAT | CHAR(n)}\n"
+                   "  {INT | FLOAT | CHAR(n) | VARCHAR(n)}\n"
+                   "storage_format:\n"
+                   "  {BITMAP | SLOTTED | PAX}\n"
                    "where_clause:\n"
                    "  condition [AND condition ...]\n"
                    "condition:\n"
@@ -44,13 +51,27 @@ const char *help_info = "Supported SQL syntax:\n"
                    "selector:\n"
                    "  {* | column [, column ...]}\n";
 
+namespace {
+
+/** @description: 以只有一列的表格把LOAD DATA、VACUUM等语句处理的记录数返回给客户端 */
+void print_utility_count(const std::string &caption, size_t count, Context *context) {
+    RecordPrinter printer(1);
+    printer.print_separator(context);
+    printer.print_record({caption}, context);
+    printer.print_separator(context);
+    printer.print_record({std::to_string(count)}, context);
+    printer.print_separator(context);
+}
+
+}  // namespace
+
 // 主要负责执行DDL语句
 void QlManager::run_mutli_query(std::shared_ptr<Plan> plan, Context *context){
     if (auto x = std::dynamic_pointer_cast<DDLPlan>(plan)) {
         switch(x->tag) {
             case T_CreateTable:
             {
-                sm_manager_->create_table(x->tab_name_, x->cols_, context);
+                sm_manager_->create_table(x->tab_name_, x->cols_, x->storage_, context);
                 break;
             }
             case T_DropTable:
@@ -75,7 +96,7 @@ void QlManager::run_mutli_query(std::shared_ptr<Plan> plan, Context *context){
     }
 }
 
-// 执行help; show tables; desc table; begin; commit; abort;语句
+// 执行help; show tables; desc table; begin; commit; abort; set; checkpoint; load data; vacuum;语句
 void QlManager::run_cmd_utility(std::shared_ptr<Plan> plan, txn_id_t *txn_id, Context *context) {
     if (auto x = std::dynamic_pointer_cast<OtherPlan>(plan)) {
         switch(x->tag) {
@@ -119,6 +140,39 @@ void QlManager::run_cmd_utility(std::shared_ptr<Plan> plan, txn_id_t *txn_id, Co
                 txn_mgr_->abort(context->txn_, context->log_mgr_);
                 break;
             }     
+            case T_SetKnob:
+            {
+                auto set_plan = std::dynamic_pointer_cast<SetKnobPlan>(x);
+                sm_manager_->set_knob(set_plan->knob_name_, set_plan->value_, context);
+                break;
+            }
+            case T_Checkpoint:
+            {
+                // 先持久化日志，再写回脏页
+                if (context->log_mgr_ != nullptr) {
+                    context->log_mgr_->flush_log_to_disk();
+                }
+                sm_manager_->checkpoint(context);
+                break;
+            }
+            case T_ShowBufferStatus:
+            {
+                sm_manager_->show_buffer_status(context);
+                break;
+            }
+            case T_LoadData:
+            {
+                auto load_plan = std::dynamic_pointer_cast<LoadDataPlan>(x);
+                size_t num_loaded = sm_manager_->load_data(load_plan->file_name_, load_plan->tab_name_, context);
+                print_utility_count("rows_loaded", num_loaded, context);
+                break;
+            }
+            case T_Vacuum:
+            {
+                int num_moved = sm_manager_->vacuum_table(x->tab_name_, context);
+                print_utility_count("rows_moved", num_moved, context);
+                break;
+            }
             default:
                 throw InternalError("Unexpected field type");
                 break;                        
@@ -163,7 +217,7 @@ void QlManager::select_from(std::unique_ptr<AbstractExecutor> executorTreeRoot,
                 col_str = std::to_string(*(int *)rec_buf);
             } else if (col.type == TYPE_FLOAT) {
                 col_str = std::to_string(*(float *)rec_buf);
-            } else if (col.type == TYPE_STRING) {
+            } else if (is_string_type(col.type)) {
                 col_str = std::string((char *)rec_buf, col.len);
                 col_str.resize(strlen(col_str.c_str()));
             }
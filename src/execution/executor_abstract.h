@@ -63,7 +63,7 @@ class AbstractExecutor {
                 val.set_int(*(int *)val_buf);
             } else if (col.type == TYPE_FLOAT) {
                 val.set_float(*(float *)val_buf);
-            } else if (col.type == TYPE_STRING) {
+            } else if (is_string_type(col.type)) {
                 std::string str_val((char *)val_buf, col.len);
                 str_val.resize(strlen(str_val.c_str()));
                 val.set_str(str_val);
@@ -75,7 +75,11 @@ class AbstractExecutor {
         return rec_dict;
     }
     bool condCheck(const RmRecord *l_record, const std::vector<Condition>& conds_, const std::vector<ColMeta>& cols_) {
-        char *l_val_buf, *r_val_buf;
+        return condCheck(l_record->data, conds_, cols_);
+    }
+    // 直接在记录数据上判断条件，data可以指向缓冲池页面中的记录（RecordView），无需先复制出RmRecord
+    bool condCheck(const char *l_data, const std::vector<Condition>& conds_, const std::vector<ColMeta>& cols_) {
+        const char *l_val_buf, *r_val_buf;
         const RmRecord *r_record;
 
         for (auto &condition : conds_) {  // 条件判断
@@ -84,7 +88,7 @@ class AbstractExecutor {
 
             // record和col确定数据位置
             auto l_col = get_col(cols_, condition.lhs_col);  // 左列元数据
-            l_val_buf = l_record->data + l_col->offset;      // 确定左数据起点
+            l_val_buf = l_data + l_col->offset;              // 确定左数据起点
 
             if (condition.is_rhs_val) {  // 值
                 r_record = condition.rhs_val.raw.get();
@@ -93,7 +97,7 @@ class AbstractExecutor {
                 cmp = ix_compare(l_val_buf, r_val_buf, condition.rhs_val.type, l_col->len);
             } else {  // 列
                 auto r_col = get_col(cols_, condition.rhs_col);
-                r_val_buf = l_record->data + r_col->offset;
+                r_val_buf = l_data + r_col->offset;
 
                 cmp = ix_compare(l_val_buf, r_val_buf, r_col->type, l_col->len);
             }
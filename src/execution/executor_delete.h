@@ -46,8 +46,12 @@ class DeleteExecutor : public AbstractExecutor {
                 continue;
             }
 
-            if (!condCheck(fh_->get_record(rid, context_).get(), conds_, cols_)) {  // 记录检查是否符合where语句
-                continue;
+            {
+                // 视图持有页面读锁，删除记录前必须释放
+                RecordView view = fh_->get_record_view(rid, context_);
+                if (!condCheck(view.data(), conds_, cols_)) {  // 记录检查是否符合where语句
+                    continue;
+                }
             }
 
             // 智能指针不能转换为普通指针
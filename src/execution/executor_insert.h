@@ -17,52 +17,76 @@ See the Mulan PSL v2 for more details. */
 
 class InsertExecutor : public AbstractExecutor {
    private:
-    TabMeta tab_;                   // 表的元数据
-    std::vector<Value> values_;     // 需要插入的数据
-    RmFileHandle *fh_;              // 表的数据文件句柄
-    std::string tab_name_;          // 表名称
-    Rid rid_;                       // 插入的位置，由于系统默认插入时不指定位置，因此当前rid_在插入后才赋值
+    TabMeta tab_;                               // 表的元数据
+    std::vector<std::vector<Value>> rows_;      // 需要插入的数据，每个元素为一行
+    RmFileHandle *fh_;                          // 表的数据文件句柄
+    std::string tab_name_;                      // 表名称
+    Rid rid_;                                   // 插入的位置，由于系统默认插入时不指定位置，因此当前rid_在插入后才赋值，多行插入时为最后一行的位置
     SmManager *sm_manager_;
 
    public:
-    InsertExecutor(SmManager *sm_manager, const std::string &tab_name, std::vector<Value> values, Context *context) {
+    InsertExecutor(SmManager *sm_manager, const std::string &tab_name, std::vector<std::vector<Value>> rows,
+                   Context *context) {
         sm_manager_ = sm_manager;
         tab_ = sm_manager_->db_.get_table(tab_name);
-        values_ = values;
+        rows_ = std::move(rows);
         tab_name_ = tab_name;
-        if (values.size() != tab_.cols.size()) {
-            throw InvalidValueCountError();
+        for (auto &row : rows_) {
+            if (row.size() != tab_.cols.size()) {
+                throw InvalidValueCountError();
+            }
         }
         fh_ = sm_manager_->fhs_.at(tab_name).get();
         context_ = context;
     };
 
     std::unique_ptr<RmRecord> Next() override {
-        // Make record buffer
-        RmRecord rec(fh_->get_file_hdr().record_size);
-        for (size_t i = 0; i < values_.size(); i++) {
-            auto &col = tab_.cols[i];
-            auto &val = values_[i];
-            if (col.type != val.type) {
-                throw IncompatibleTypeError(coltype2str(col.type), coltype2str(val.type));
+        // Make record buffer，所有行依次存放在同一块缓冲区中，类型检查全部通过后再写入
+        int record_size = fh_->get_file_hdr().record_size;
+        int num_rows = static_cast<int>(rows_.size());
+        std::vector<char> recs(static_cast<size_t>(num_rows) * record_size);
+        for (int r = 0; r < num_rows; r++) {
+            char *rec = recs.data() + static_cast<size_t>(r) * record_size;
+            for (size_t i = 0; i < rows_[r].size(); i++) {
+                auto &col = tab_.cols[i];
+                auto &val = rows_[r][i];
+                if (!is_compatible_type(col.type, val.type)) {
+                    throw IncompatibleTypeError(coltype2str(col.type), coltype2str(val.type));
+                }
+                val.init_raw(col.len);
+                memcpy(rec + col.offset, val.raw->data, col.len);
+            }
+        }
+        // Insert into record file，每个页面只pin一次
+        std::vector<Rid> rids;
+        rids.reserve(num_rows);
+        try {
+            fh_->insert_records(recs.data(), num_rows, &rids, context_);
+        } catch (...) {
+            // 插入中途出错时，已经插入的记录也追加在rids中，全部删除后整条INSERT不留下任何记录
+            for (auto it = rids.rbegin(); it != rids.rend(); ++it) {
+                fh_->delete_record(*it, context_);
             }
-            val.init_raw(col.len);
-            memcpy(rec.data + col.offset, val.raw->data, col.len);
+            throw;
         }
-        // Insert into record file
-        rid_ = fh_->insert_record(rec.data, context_);
-        
-        // Insert into index
-        for(size_t i = 0; i < tab_.indexes.size(); ++i) {
-            auto& index = tab_.indexes[i];
+        if (!rids.empty()) {
+            rid_ = rids.back();
+        }
+
+        // Insert into index，每个索引排序后批量插入
+        for (auto &index : tab_.indexes) {
             auto ih = sm_manager_->ihs_.at(sm_manager_->get_ix_manager()->get_index_name(tab_name_, index.cols)).get();
-            char* key = new char[index.col_tot_len];
-            int offset = 0;
-            for(size_t i = 0; i < index.col_num; ++i) {
-                memcpy(key + offset, rec.data + index.cols[i].offset, index.cols[i].len);
-                offset += index.cols[i].len;
+            std::vector<char> keys(static_cast<size_t>(num_rows) * index.col_tot_len);
+            for (int r = 0; r < num_rows; r++) {
+                const char *rec = recs.data() + static_cast<size_t>(r) * record_size;
+                char *key = keys.data() + static_cast<size_t>(r) * index.col_tot_len;
+                int offset = 0;
+                for (size_t i = 0; i < index.col_num; ++i) {
+                    memcpy(key + offset, rec + index.cols[i].offset, index.cols[i].len);
+                    offset += index.cols[i].len;
+                }
             }
-            ih->insert_entry(key, rid_, context_->txn_);
+            ih->insert_entries(keys.data(), rids, context_->txn_);
         }
         return nullptr;
     }
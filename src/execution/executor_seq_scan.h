@@ -24,6 +24,9 @@ class SeqScanExecutor : public AbstractExecutor {
     std::vector<ColMeta> cols_;         // scan后生成的记录的字段
     size_t len_;                        // scan后生成的每条记录的长度
     std::vector<Condition> fed_conds_;  // 同conds_，两个字段相同
+    std::vector<RmVarCol> read_cols_;   // PAX格式的表只读取这些字段，为空时读取整条记录
+    std::vector<char> buf_;             // 只读取部分字段时，存放当前记录中读出的字段，其他字段为0
+    std::vector<RmZonePred> zone_preds_;  // 能用页面摘要判断的扫描条件，常量指向conds_中的值
 
     Rid rid_;
     std::unique_ptr<RecScan> scan_;  // table_iterator
@@ -31,7 +34,8 @@ class SeqScanExecutor : public AbstractExecutor {
     SmManager *sm_manager_;
 
    public:
-    SeqScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, Context *context) {
+    SeqScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, Context *context,
+                    const std::vector<TabCol> &read_cols = {}) {
         sm_manager_ = sm_manager;
         tab_name_ = std::move(tab_name);
         conds_ = std::move(conds);
@@ -41,14 +45,23 @@ class SeqScanExecutor : public AbstractExecutor {
         len_ = cols_.back().offset + cols_.back().len;
         context_ = context;
         fed_conds_ = conds_;
+        // 只有PAX格式的表按字段存放，读取部分字段才能少访问数据
+        if (fh_->get_file_hdr().format == RM_FORMAT_PAX && !read_cols.empty() && read_cols.size() < cols_.size()) {
+            for (auto &read_col : read_cols) {
+                auto col = get_col(cols_, read_col);
+                read_cols_.push_back(RmVarCol{static_cast<uint16_t>(col->offset), static_cast<uint16_t>(col->len)});
+            }
+            buf_.assign(len_, 0);
+        }
+        init_zone_preds();
     }
 
     void beginTuple() override {
-        scan_ = std::make_unique<RmScan>(fh_);  // 初始化迭代器
+        scan_ = std::make_unique<RmScan>(fh_, zone_preds_);  // 初始化迭代器，跳过页面摘要表明不满足条件的页面
         rid_ = scan_->rid();
 
         while (!scan_->is_end()) {
-            if (condCheck(fh_->get_record(rid_, context_).get(), conds_, cols_)) break;
+            if (is_match()) break;
             scan_->next();
             rid_ = scan_->rid();
         }
@@ -58,14 +71,21 @@ class SeqScanExecutor : public AbstractExecutor {
         // 条件判断
         for (scan_->next(); !scan_->is_end(); scan_->next()) {
             rid_ = scan_->rid();
-            if (condCheck(fh_->get_record(rid_, context_).get(), conds_, cols_)) break;
+            if (is_match()) break;
         }
     }
 
     [[nodiscard]] bool is_end() const override { return scan_->is_end(); }
 
     std::unique_ptr<RmRecord> Next() override {
-        return fh_->get_record(rid_, context_);
+        if (read_cols_.empty()) {
+            return fh_->get_record(rid_, context_);
+        }
+        // 有扫描条件时is_match()已经读出了当前记录的字段
+        if (conds_.empty()) {
+            fh_->get_record_cols(rid_, read_cols_, buf_.data());
+        }
+        return std::make_unique<RmRecord>(static_cast<int>(len_), buf_.data());
     }
 
     Rid &rid() override { return rid_; }
@@ -73,4 +93,44 @@ class SeqScanExecutor : public AbstractExecutor {
     [[nodiscard]] size_t tupleLen() const override { return len_; };
     std::string getType() override { return "SeqScanExecutor"; };
     [[nodiscard]] const std::vector<ColMeta> &cols() const override { return cols_; };
+
+   private:
+    /**
+     * @description: 从扫描条件中找出 摘要字段 op 常量 形式的条件，常量与字段类型相同时才能按摘要字段的规则比较
+     */
+    void init_zone_preds() {
+        const RmFileHdr &file_hdr = fh_->get_file_hdr();
+        for (auto &cond : conds_) {
+            if (!cond.is_rhs_val || cond.rhs_val.raw == nullptr) {
+                continue;
+            }
+            auto col = get_col(cols_, cond.lhs_col);
+            if (!is_compatible_type(col->type, cond.rhs_val.type)) {
+                continue;
+            }
+            for (int i = 0; i < file_hdr.num_zone_cols; i++) {
+                if (file_hdr.zone_cols[i].offset == col->offset) {
+                    zone_preds_.push_back(RmZonePred{i, cond.op, cond.rhs_val.raw->data});
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @description: 判断当前rid_对应的记录是否满足scan条件。条件直接在缓冲池页面中的记录视图上判断，
+     * 不复制记录，判断结束后视图即释放页面；只有Next()返回满足条件的记录时才复制一次。
+     * 只读取部分字段时，把用到的字段读到buf_中判断
+     */
+    bool is_match() {
+        if (conds_.empty()) {
+            return true;
+        }
+        if (!read_cols_.empty()) {
+            fh_->get_record_cols(rid_, read_cols_, buf_.data());
+            return condCheck(buf_.data(), conds_, cols_);
+        }
+        RecordView view = fh_->get_record_view(rid_, context_);
+        return condCheck(view.data(), conds_, cols_);
+    }
 };
\ No newline at end of file
@@ -10,6 +10,9 @@ See the Mulan PSL v2 for more details. */
 
 #include "ix_index_handle.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "ix_scan.h"
 
 /**
@@ -151,8 +154,7 @@ IxIndexHandle::IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffe
     file_hdr_->deserialize(buf);
     
     // disk_manager管理的fd对应的文件中，设置从file_hdr_->num_pages开始分配page_no
-    int now_page_no = disk_manager_->get_fd2pageno(fd);
-    disk_manager_->set_fd2pageno(fd, now_page_no + 1);
+    disk_manager_->set_fd2pageno(fd, file_hdr_->num_pages_);
 }
 
 /**
@@ -249,6 +251,25 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
     return -1;
 }
 
+/**
+ * @brief 批量插入键值对。先按key排序再依次插入，相邻的key落在同一个叶子结点上，
+ * 避免乱序插入时在不同叶子结点之间来回换入换出
+ * @param keys 依次存放的key，每个key的长度为file_hdr_->col_tot_len_
+ * @param values 与keys一一对应的rid
+ * @param transaction 事务指针
+ */
+void IxIndexHandle::insert_entries(const char *keys, const std::vector<Rid> &values, Transaction *transaction) {
+    size_t key_len = file_hdr_->col_tot_len_;
+    std::vector<size_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return ix_compare(keys + a * key_len, keys + b * key_len, file_hdr_->col_types_, file_hdr_->col_lens_) < 0;
+    });
+    for (size_t i : order) {
+        insert_entry(keys + i * key_len, values[i], transaction);
+    }
+}
+
 /**
  * @brief 用于删除B+树中含有指定key的键值对
  * @param key 要删除的key值
@@ -443,11 +464,12 @@ IxNodeHandle *IxIndexHandle::fetch_node(int page_no) const {
  */
 IxNodeHandle *IxIndexHandle::create_node() {
     IxNodeHandle *node;
-    file_hdr_->num_pages_++;
 
     PageId new_page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
     // 从3开始分配page_no，第一次分配之后，new_page_id.page_no=3，file_hdr_.num_pages=4
+    // disk_manager优先复用被合并结点释放的页面，此时文件的页面个数不变
     Page *page = buffer_pool_manager_->new_page(&new_page_id);
+    file_hdr_->num_pages_ = std::max(file_hdr_->num_pages_, new_page_id.page_no + 1);
     node = new IxNodeHandle(file_hdr_, page);
     return node;
 }
@@ -494,14 +516,24 @@ void IxIndexHandle::erase_leaf(IxNodeHandle *leaf) {
 }
 
 /**
- * @brief 删除node时，更新file_hdr_.num_pages
+ * @brief 删除node时，释放node所在的页面，页号归还给disk_manager，之后create_node优先复用
  *
- * @param node
+ * @param node 被合并而不再使用的结点，调用者持有其页面唯一的pin
+ * @note 释放成功后页面不在缓冲池中，调用者不能再访问或unpin该结点；
+ * 页面还被其他线程固定时不释放，只unpin，页面留在文件中
  */
 void IxIndexHandle::release_node_handle(IxNodeHandle &node) {
-    file_hdr_->num_pages_--;
+    PageId page_id = node.get_page_id();
+    if (!buffer_pool_manager_->free_page(page_id)) {
+        buffer_pool_manager_->unpin_page(page_id, false);
+    }
 }
 
+/**
+ * @brief 收缩索引文件，截断文件末尾已经释放的页面，文件头中记录收缩后的页面个数，由IxManager::close_index调用
+ */
+void IxIndexHandle::shrink_file() const { file_hdr_->num_pages_ -= disk_manager_->shrink_file(fd_); }
+
 /**
  * @brief 将node的第child_idx个孩子结点的父节点置为node
  */
@@ -30,6 +30,7 @@ inline int ix_compare(const char *a, const char *b, ColType type, int col_len) {
             return (fa < fb) ? -1 : ((fa > fb) ? 1 : 0);
         }
         case TYPE_STRING:
+        case TYPE_VARCHAR:
             return memcmp(a, b, col_len);
         default:
             throw InternalError("Unexpected data type");
@@ -172,6 +173,8 @@ class IxIndexHandle {
    public:
     IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd);
 
+    int get_fd() const { return fd_; }
+
     // for search
     bool get_value(const char *key, std::vector<Rid> *result, Transaction *transaction);
 
@@ -181,6 +184,8 @@ class IxIndexHandle {
     // for insert
     page_id_t insert_entry(const char *key, const Rid &value, Transaction *transaction);
 
+    void insert_entries(const char *keys, const std::vector<Rid> &values, Transaction *transaction);
+
     IxNodeHandle *split(IxNodeHandle *node);
 
     void insert_into_parent(IxNodeHandle *old_node, const char *key, IxNodeHandle *new_node, Transaction *transaction);
@@ -205,6 +210,8 @@ class IxIndexHandle {
 
     Iid leaf_begin() const;
 
+    void shrink_file() const;
+
    private:
     // 辅助函数
     void update_root_page_no(page_id_t root) { file_hdr_->root_page_ = root; }
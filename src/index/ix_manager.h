@@ -146,22 +146,35 @@ class IxManager {
     // 注意这里打开文件，创建并返回了index file handle的指针
     std::unique_ptr<IxIndexHandle> open_index(const std::string &filename, const std::vector<ColMeta>& index_cols) {
         std::string ix_name = get_index_name(filename, index_cols);
-        int fd = disk_manager_->open_file(ix_name);
+        int fd = disk_manager_->open_file(ix_name, DIRECT_IO);
         return std::make_unique<IxIndexHandle>(disk_manager_, buffer_pool_manager_, fd);
     }
 
     std::unique_ptr<IxIndexHandle> open_index(const std::string &filename, const std::vector<std::string>& index_cols) {
         std::string ix_name = get_index_name(filename, index_cols);
-        int fd = disk_manager_->open_file(ix_name);
+        int fd = disk_manager_->open_file(ix_name, DIRECT_IO);
         return std::make_unique<IxIndexHandle>(disk_manager_, buffer_pool_manager_, fd);
     }
 
-    void close_index(const IxIndexHandle *ih) {
+    // 把索引文件在缓冲池中的脏页和文件头写回磁盘，文件保持打开
+    FlushStats flush_index(const IxIndexHandle *ih) {
+        FlushStats stats = buffer_pool_manager_->flush_all_pages(ih->fd_);
         char* data = new char[ih->file_hdr_->tot_len_];
         ih->file_hdr_->serialize(data);
         disk_manager_->write_page(ih->fd_, IX_FILE_HDR_PAGE, data, ih->file_hdr_->tot_len_);
+        delete[] data;
+        return stats;
+    }
+
+    void close_index(const IxIndexHandle *ih) {
         // 缓冲区的所有页刷到磁盘，注意这句话必须写在close_file前面
         buffer_pool_manager_->flush_all_pages(ih->fd_);
+        // 离线收缩：截断文件末尾已经释放的页面，文件头中记录收缩后的页面个数
+        ih->shrink_file();
+        char* data = new char[ih->file_hdr_->tot_len_];
+        ih->file_hdr_->serialize(data);
+        disk_manager_->write_page(ih->fd_, IX_FILE_HDR_PAGE, data, ih->file_hdr_->tot_len_);
+        delete[] data;
         disk_manager_->close_file(ih->fd_);
     }
 };
\ No newline at end of file
@@ -25,7 +25,39 @@ void IxScan::next() {
         // go to next leaf
         iid_.slot_no = 0;
         iid_.page_no = node->get_next_leaf();
+        if (--leaves_until_prefetch_ <= 0) {
+            prefetch(iid_.page_no);
+        }
     }
+    bpm_->unpin_page(node->get_page_id(), false);
+    delete node;
+}
+
+/**
+ * @brief 沿着next_leaf异步预读leaf_page_no之后的PREFETCH_DISTANCE个叶子结点，每经过一半的叶子结点提交一次
+ */
+void IxScan::prefetch(int leaf_page_no) {
+    leaves_until_prefetch_ = PREFETCH_DISTANCE / 2;
+    int last_leaf = ih_->file_hdr_->last_leaf_;
+    if (leaf_page_no == last_leaf) {
+        return;
+    }
+    // 与预读线程一样持有叶子结点的读锁读取next_leaf
+    int first;
+    {
+        ReadPageGuard guard = bpm_->fetch_page_read(PageId{ih_->fd_, leaf_page_no});
+        if (!guard.is_valid()) {
+            return;
+        }
+        first = reinterpret_cast<const IxPageHdr *>(guard.get_data())->next_leaf;
+    }
+    bpm_->prefetch_chain(ih_->fd_, first, PREFETCH_DISTANCE, [last_leaf](Page *page) {
+        auto page_hdr = reinterpret_cast<IxPageHdr *>(page->get_data());
+        if (!page_hdr->is_leaf || page->get_page_id().page_no == last_leaf) {
+            return IX_NO_PAGE;
+        }
+        return page_hdr->next_leaf;
+    });
 }
 
 Rid IxScan::rid() const {
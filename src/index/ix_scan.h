@@ -23,10 +23,15 @@ class IxScan : public RecScan {
     Iid iid_;  // 初始为lower（用于遍历的指针）
     Iid end_;  // 初始为upper
     BufferPoolManager *bpm_;
+    int leaves_until_prefetch_ = 0;  // 再经过多少个叶子结点需要提交下一次预读
 
    public:
     IxScan(const IxIndexHandle *ih, const Iid &lower, const Iid &upper, BufferPoolManager *bpm)
-        : ih_(ih), iid_(lower), end_(upper), bpm_(bpm) {}
+        : ih_(ih), iid_(lower), end_(upper), bpm_(bpm) {
+        if (!is_end()) {
+            prefetch(iid_.page_no);
+        }
+    }
 
     void next() override;
 
@@ -35,4 +40,7 @@ class IxScan : public RecScan {
     Rid rid() const override;
 
     const Iid &iid() const { return iid_; }
+
+   private:
+    void prefetch(int leaf_page_no);
 };
\ No newline at end of file
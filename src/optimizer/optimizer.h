@@ -38,6 +38,15 @@ class Optimizer {
         } else if (auto x = std::dynamic_pointer_cast<ast::ShowTables>(query->parse)) {
             // show tables;
             return std::make_shared<OtherPlan>(T_ShowTable, std::string());
+        } else if (auto x = std::dynamic_pointer_cast<ast::Checkpoint>(query->parse)) {
+            // checkpoint;
+            return std::make_shared<OtherPlan>(T_Checkpoint, std::string());
+        } else if (auto x = std::dynamic_pointer_cast<ast::ShowBufferStatus>(query->parse)) {
+            // show buffer status;
+            return std::make_shared<OtherPlan>(T_ShowBufferStatus, std::string());
+        } else if (auto x = std::dynamic_pointer_cast<ast::Vacuum>(query->parse)) {
+            // vacuum table;
+            return std::make_shared<OtherPlan>(T_Vacuum, x->tab_name);
         } else if (auto x = std::dynamic_pointer_cast<ast::DescTable>(query->parse)) {
             // desc table;
             return std::make_shared<OtherPlan>(T_DescTable, x->tab_name);
@@ -53,6 +62,12 @@ class Optimizer {
         } else if (auto x = std::dynamic_pointer_cast<ast::TxnRollback>(query->parse)) {
             // rollback;
             return std::make_shared<OtherPlan>(T_Transaction_rollback, std::string());
+        } else if (auto x = std::dynamic_pointer_cast<ast::LoadData>(query->parse)) {
+            // load data 'file_name' into table;
+            return std::make_shared<LoadDataPlan>(x->file_name, x->tab_name);
+        } else if (auto x = std::dynamic_pointer_cast<ast::SetKnob>(query->parse)) {
+            // set knob = value;
+            return std::make_shared<SetKnobPlan>(x->knob_name, query->values[0]);
         } else {
             return planner_->do_planner(query, context);
         }
@@ -36,6 +36,11 @@ typedef enum PlanTag{
     T_Transaction_commit,
     T_Transaction_abort,
     T_Transaction_rollback,
+    T_SetKnob,
+    T_Checkpoint,
+    T_ShowBufferStatus,
+    T_LoadData,
+    T_Vacuum,
     T_SeqScan,
     T_IndexScan,
     T_NestLoop,
@@ -74,6 +79,7 @@ class ScanPlan : public Plan
         size_t len_;                               
         std::vector<Condition> fed_conds_;
         std::vector<std::string> index_col_names_;
+        std::vector<TabCol> read_cols_;     // 上层算子和扫描条件用到的字段，为空时读取整条记录
     
 };
 
@@ -138,7 +144,7 @@ class DMLPlan : public Plan
     public:
         DMLPlan(PlanTag tag, std::shared_ptr<Plan> subplan,std::string tab_name,
                 std::vector<Value> values, std::vector<Condition> conds,
-                std::vector<SetClause> set_clauses)
+                std::vector<SetClause> set_clauses, std::vector<std::vector<Value>> rows = {})
         {
             Plan::tag = tag;
             subplan_ = std::move(subplan);
@@ -146,11 +152,13 @@ class DMLPlan : public Plan
             values_ = std::move(values);
             conds_ = std::move(conds);
             set_clauses_ = std::move(set_clauses);
+            rows_ = std::move(rows);
         }
         ~DMLPlan(){}
         std::shared_ptr<Plan> subplan_;
         std::string tab_name_;
         std::vector<Value> values_;
+        std::vector<std::vector<Value>> rows_;  // insert语句的多行values值
         std::vector<Condition> conds_;
         std::vector<SetClause> set_clauses_;
 };
@@ -159,17 +167,20 @@ class DMLPlan : public Plan
 class DDLPlan : public Plan
 {
     public:
-        DDLPlan(PlanTag tag, std::string tab_name, std::vector<std::string> col_names, std::vector<ColDef> cols)
+        DDLPlan(PlanTag tag, std::string tab_name, std::vector<std::string> col_names, std::vector<ColDef> cols,
+                std::string storage = "")
         {
             Plan::tag = tag;
             tab_name_ = std::move(tab_name);
             cols_ = std::move(cols);
             tab_col_names_ = std::move(col_names);
+            storage_ = std::move(storage);
         }
         ~DDLPlan(){}
         std::string tab_name_;
         std::vector<std::string> tab_col_names_;
         std::vector<ColDef> cols_;
+        std::string storage_;   // create table的页面格式
 };
 
 // help; show tables; desc tables; begin; abort; commit; rollback语句对应的plan
@@ -185,6 +196,32 @@ class OtherPlan : public Plan
         std::string tab_name_;
 };
 
+// set语句的计划，tab_name_为空
+class SetKnobPlan : public OtherPlan
+{
+    public:
+        SetKnobPlan(std::string knob_name, Value value) : OtherPlan(T_SetKnob, std::string())
+        {
+            knob_name_ = std::move(knob_name);
+            value_ = std::move(value);
+        }
+        ~SetKnobPlan(){}
+        std::string knob_name_;
+        Value value_;
+};
+
+// load data语句的计划，tab_name_为导入的表
+class LoadDataPlan : public OtherPlan
+{
+    public:
+        LoadDataPlan(std::string file_name, std::string tab_name) : OtherPlan(T_LoadData, std::move(tab_name))
+        {
+            file_name_ = std::move(file_name);
+        }
+        ~LoadDataPlan(){}
+        std::string file_name_;
+};
+
 class plannerInfo{
     public:
     std::shared_ptr<ast::SelectStmt> parse;
@@ -11,6 +11,7 @@ See the Mulan PSL v2 for more details. */
 #include "planner.h"
 
 #include <memory>
+#include <set>
 
 #include "execution/executor_delete.h"
 #include "execution/executor_index_scan.h"
@@ -271,11 +272,47 @@ std::shared_ptr<Plan> Planner::generate_select_plan(std::shared_ptr<Query> query
     // 物理优化
     auto sel_cols = query->cols;
     std::shared_ptr<Plan> plannerRoot = physical_optimization(query, context);
+    set_scan_read_cols(plannerRoot, sel_cols);
     plannerRoot = std::make_shared<ProjectionPlan>(T_Projection, std::move(plannerRoot), std::move(sel_cols));
 
     return plannerRoot;
 }
 
+/**
+ * @brief 自顶向下收集各个算子用到的字段，告诉每个扫描算子只需要读取哪些字段，
+ * PAX格式的表扫描时只访问这些字段的minipage
+ *
+ * @param plan 当前算子
+ * @param used_cols 上层算子用到的字段
+ */
+void Planner::set_scan_read_cols(std::shared_ptr<Plan> plan, std::vector<TabCol> used_cols) {
+    auto add_cond_cols = [&used_cols](const std::vector<Condition> &conds) {
+        for (auto &cond : conds) {
+            used_cols.push_back(cond.lhs_col);
+            if (!cond.is_rhs_val) {
+                used_cols.push_back(cond.rhs_col);
+            }
+        }
+    };
+    if (auto x = std::dynamic_pointer_cast<ScanPlan>(plan)) {
+        add_cond_cols(x->conds_);
+        std::set<TabCol> read_cols;
+        for (auto &col : used_cols) {
+            if (col.tab_name == x->tab_name_) {
+                read_cols.insert(col);
+            }
+        }
+        x->read_cols_.assign(read_cols.begin(), read_cols.end());
+    } else if (auto x = std::dynamic_pointer_cast<JoinPlan>(plan)) {
+        add_cond_cols(x->conds_);
+        set_scan_read_cols(x->left_, used_cols);
+        set_scan_read_cols(x->right_, used_cols);
+    } else if (auto x = std::dynamic_pointer_cast<SortPlan>(plan)) {
+        used_cols.push_back(x->sel_col_);
+        set_scan_read_cols(x->subplan_, used_cols);
+    }
+}
+
 // 生成DDL语句和DML语句的查询执行计划
 std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context *context) {
     std::shared_ptr<Plan> plannerRoot;
@@ -292,7 +329,8 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
                 throw InternalError("Unexpected field type");
             }
         }
-        plannerRoot = std::make_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs);
+        plannerRoot =
+            std::make_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs, x->storage);
     } else if (auto x = std::dynamic_pointer_cast<ast::DropTable>(query->parse)) {
         // drop table;
         plannerRoot =
@@ -305,8 +343,8 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
         plannerRoot = std::make_shared<DDLPlan>(T_DropIndex, x->tab_name, x->col_names, std::vector<ColDef>());
     } else if (auto x = std::dynamic_pointer_cast<ast::InsertStmt>(query->parse)) {
         // insert;
-        plannerRoot = std::make_shared<DMLPlan>(T_Insert, std::shared_ptr<Plan>(), x->tab_name, query->values,
-                                                std::vector<Condition>(), std::vector<SetClause>());
+        plannerRoot = std::make_shared<DMLPlan>(T_Insert, std::shared_ptr<Plan>(), x->tab_name, std::vector<Value>(),
+                                                std::vector<Condition>(), std::vector<SetClause>(), query->rows);
     } else if (auto x = std::dynamic_pointer_cast<ast::DeleteStmt>(query->parse)) {
         // delete;
         // 生成表扫描方式
@@ -19,7 +19,7 @@ enum JoinType {
 namespace ast {
 
 enum SvType {
-    SV_TYPE_INT, SV_TYPE_FLOAT, SV_TYPE_STRING
+    SV_TYPE_INT, SV_TYPE_FLOAT, SV_TYPE_STRING, SV_TYPE_VARCHAR
 };
 
 enum SvCompOp {
@@ -43,6 +43,21 @@ struct Help : public TreeNode {
 struct ShowTables : public TreeNode {
 };
 
+// CHECKPOINT，把所有脏页写回磁盘
+struct Checkpoint : public TreeNode {
+};
+
+// SHOW BUFFER STATUS，显示缓冲池和磁盘I/O的统计
+struct ShowBufferStatus : public TreeNode {
+};
+
+// VACUUM tab_name，整理表的数据文件，把稀疏页面中的记录移到前面的页面并截断文件末尾的空页面
+struct Vacuum : public TreeNode {
+    std::string tab_name;
+
+    Vacuum(std::string tab_name_) : tab_name(std::move(tab_name_)) {}
+};
+
 struct TxnBegin : public TreeNode {
 };
 
@@ -76,9 +91,10 @@ struct ColDef : public Field {
 struct CreateTable : public TreeNode {
     std::string tab_name;
     std::vector<std::shared_ptr<Field>> fields;
+    std::string storage;    // STORAGE = <format>子句指定的页面格式，为空时按字段自动选择
 
-    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_) :
-            tab_name(std::move(tab_name_)), fields(std::move(fields_)) {}
+    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_, std::string storage_ = "") :
+            tab_name(std::move(tab_name_)), fields(std::move(fields_)), storage(std::move(storage_)) {}
 };
 
 struct DropTable : public TreeNode {
@@ -168,10 +184,19 @@ struct OrderBy : public TreeNode
 
 struct InsertStmt : public TreeNode {
     std::string tab_name;
-    std::vector<std::shared_ptr<Value>> vals;
+    std::vector<std::vector<std::shared_ptr<Value>>> rows;  // VALUES后的每一行
 
-    InsertStmt(std::string tab_name_, std::vector<std::shared_ptr<Value>> vals_) :
-            tab_name(std::move(tab_name_)), vals(std::move(vals_)) {}
+    InsertStmt(std::string tab_name_, std::vector<std::vector<std::shared_ptr<Value>>> rows_) :
+            tab_name(std::move(tab_name_)), rows(std::move(rows_)) {}
+};
+
+// LOAD DATA 'file_name' INTO tab_name，从CSV文件批量导入数据
+struct LoadData : public TreeNode {
+    std::string file_name;
+    std::string tab_name;
+
+    LoadData(std::string file_name_, std::string tab_name_) :
+            file_name(std::move(file_name_)), tab_name(std::move(tab_name_)) {}
 };
 
 struct DeleteStmt : public TreeNode {
@@ -225,6 +250,15 @@ struct SelectStmt : public TreeNode {
             }
 };
 
+// SET knob_name = value，修改一个运行时参数
+struct SetKnob : public TreeNode {
+    std::string knob_name;
+    std::shared_ptr<Value> val;
+
+    SetKnob(std::string knob_name_, std::shared_ptr<Value> val_) :
+            knob_name(std::move(knob_name_)), val(std::move(val_)) {}
+};
+
 // Semantic value
 struct SemValue {
     int sv_int;
@@ -246,6 +280,7 @@ struct SemValue {
 
     std::shared_ptr<Value> sv_val;
     std::vector<std::shared_ptr<Value>> sv_vals;
+    std::vector<std::vector<std::shared_ptr<Value>>> sv_val_rows;
 
     std::shared_ptr<Col> sv_col;
     std::vector<std::shared_ptr<Col>> sv_cols;
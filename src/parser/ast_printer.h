@@ -46,6 +46,7 @@ private:
                 {SV_TYPE_INT,    "INT"},
                 {SV_TYPE_FLOAT,  "FLOAT"},
                 {SV_TYPE_STRING, "STRING"},
+                {SV_TYPE_VARCHAR, "VARCHAR"},
         };
         return m.at(type);
     }
@@ -79,13 +80,27 @@ private:
             std::cout << "HELP\n";
         } else if (auto x = std::dynamic_pointer_cast<ShowTables>(node)) {
             std::cout << "SHOW_TABLES\n";
+        } else if (auto x = std::dynamic_pointer_cast<Checkpoint>(node)) {
+            std::cout << "CHECKPOINT\n";
+        } else if (auto x = std::dynamic_pointer_cast<ShowBufferStatus>(node)) {
+            std::cout << "SHOW_BUFFER_STATUS\n";
+        } else if (auto x = std::dynamic_pointer_cast<Vacuum>(node)) {
+            std::cout << "VACUUM\n";
+            print_val(x->tab_name, offset);
         } else if (auto x = std::dynamic_pointer_cast<CreateTable>(node)) {
             std::cout << "CREATE_TABLE\n";
             print_val(x->tab_name, offset);
             print_node_list(x->fields, offset);
+            if (!x->storage.empty()) {
+                print_val(x->storage, offset);
+            }
         } else if (auto x = std::dynamic_pointer_cast<DropTable>(node)) {
             std::cout << "DROP_TABLE\n";
             print_val(x->tab_name, offset);
+        } else if (auto x = std::dynamic_pointer_cast<SetKnob>(node)) {
+            std::cout << "SET_KNOB\n";
+            print_val(x->knob_name, offset);
+            print_node(x->val, offset);
         } else if (auto x = std::dynamic_pointer_cast<DescTable>(node)) {
             std::cout << "DESC_TABLE\n";
             print_val(x->tab_name, offset);
@@ -134,7 +149,13 @@ private:
         } else if (auto x = std::dynamic_pointer_cast<InsertStmt>(node)) {
             std::cout << "INSERT\n";
             print_val(x->tab_name, offset);
-            print_node_list(x->vals, offset);
+            for (auto &row : x->rows) {
+                print_node_list(row, offset);
+            }
+        } else if (auto x = std::dynamic_pointer_cast<LoadData>(node)) {
+            std::cout << "LOAD_DATA\n";
+            print_val(x->file_name, offset);
+            print_val(x->tab_name, offset);
         } else if (auto x = std::dynamic_pointer_cast<DeleteStmt>(node)) {
             std::cout << "DELETE\n";
             print_val(x->tab_name, offset);
@@ -24,6 +24,14 @@ int main() {
         "drop index tb(a, b, c);",
         "drop index tb(b);",
         "insert into tb values (1, 3.14, 'pi');",
+        "insert into tb values (1, 3.14, 'pi'), (2, 2.72, 'e');",
+        "load data 'tb.csv' into tb;",
+        "vacuum tb;",
+        "show buffer status;",
+        "create table status (buffer int, status char(8));",
+        "select status.buffer from status where status = 'ok';",
+        "load data 'data.csv' into data;",
+        "update data set load = 1 where data = 'x';",
         "delete from tb where a = 1;",
         "update tb set a = 1, b = 2.2, c = 'xyz' where x = 2 and y < 1.1 and z > 'abc';",
         "select * from tb;",
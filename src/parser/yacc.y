@@ -22,7 +22,10 @@ using namespace ast;
 
 // keywords
 %token SHOW TABLES CREATE TABLE DROP DESC INSERT INTO VALUES DELETE FROM ASC ORDER BY
-WHERE UPDATE SET SELECT INT CHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY
+WHERE UPDATE SET SELECT INT CHAR VARCHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY
+CHECKPOINT STORAGE VACUUM
+// non-reserved keywords, also accepted as identifiers
+%token <sv_str> BUFFER STATUS LOAD DATA
 // non-keywords
 %token LEQ NEQ GEQ T_EOF
 
@@ -32,7 +35,7 @@ WHERE UPDATE SET SELECT INT CHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_CO
 %token <sv_float> VALUE_FLOAT
 
 // specify types for non-terminal symbol
-%type <sv_node> stmt dbStmt ddl dml txnStmt
+%type <sv_node> stmt dbStmt ddl dml txnStmt setStmt
 %type <sv_field> field
 %type <sv_fields> fieldList
 %type <sv_type_len> type
@@ -40,7 +43,8 @@ WHERE UPDATE SET SELECT INT CHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_CO
 %type <sv_expr> expr
 %type <sv_val> value
 %type <sv_vals> valueList
-%type <sv_str> tbName colName
+%type <sv_val_rows> valueRows
+%type <sv_str> tbName colName identifier optStorageClause
 %type <sv_strs> tableList colNameList
 %type <sv_col> col
 %type <sv_cols> colList selector
@@ -80,6 +84,14 @@ stmt:
     |   ddl
     |   dml
     |   txnStmt
+    |   setStmt
+    ;
+
+setStmt:
+        SET IDENTIFIER '=' value
+    {
+        $$ = std::make_shared<SetKnob>($2, $4);
+    }
     ;
 
 txnStmt:
@@ -106,12 +118,24 @@ dbStmt:
     {
         $$ = std::make_shared<ShowTables>();
     }
+    |   CHECKPOINT
+    {
+        $$ = std::make_shared<Checkpoint>();
+    }
+    |   SHOW BUFFER STATUS
+    {
+        $$ = std::make_shared<ShowBufferStatus>();
+    }
+    |   VACUUM tbName
+    {
+        $$ = std::make_shared<Vacuum>($2);
+    }
     ;
 
 ddl:
-        CREATE TABLE tbName '(' fieldList ')'
+        CREATE TABLE tbName '(' fieldList ')' optStorageClause
     {
-        $$ = std::make_shared<CreateTable>($3, $5);
+        $$ = std::make_shared<CreateTable>($3, $5, $7);
     }
     |   DROP TABLE tbName
     {
@@ -132,9 +156,13 @@ ddl:
     ;
 
 dml:
-        INSERT INTO tbName VALUES '(' valueList ')'
+        INSERT INTO tbName VALUES valueRows
     {
-        $$ = std::make_shared<InsertStmt>($3, $6);
+        $$ = std::make_shared<InsertStmt>($3, $5);
+    }
+    |   LOAD DATA VALUE_STRING INTO tbName
+    {
+        $$ = std::make_shared<LoadData>($3, $5);
     }
     |   DELETE FROM tbName optWhereClause
     {
@@ -188,12 +216,24 @@ type:
     {
         $$ = std::make_shared<TypeLen>(SV_TYPE_STRING, $3);
     }
+    |   VARCHAR '(' VALUE_INT ')'
+    {
+        $$ = std::make_shared<TypeLen>(SV_TYPE_VARCHAR, $3);
+    }
     |   FLOAT
     {
         $$ = std::make_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
     }
     ;
 
+optStorageClause:
+        /* epsilon */ { /* ignore*/ }
+    |   STORAGE '=' IDENTIFIER
+    {
+        $$ = $3;
+    }
+    ;
+
 valueList:
         value
     {
@@ -205,6 +245,17 @@ valueList:
     }
     ;
 
+valueRows:
+        '(' valueList ')'
+    {
+        $$ = std::vector<std::vector<std::shared_ptr<Value>>>{$2};
+    }
+    |   valueRows ',' '(' valueList ')'
+    {
+        $$.push_back($4);
+    }
+    ;
+
 value:
         VALUE_INT
     {
@@ -368,7 +419,15 @@ opt_asc_desc:
     |       { $$ = OrderBy_DEFAULT; }
     ;    
 
-tbName: IDENTIFIER;
+tbName: identifier;
+
+colName: identifier;
 
-colName: IDENTIFIER;
+identifier:
+        IDENTIFIER
+    |   BUFFER
+    |   STATUS
+    |   LOAD
+    |   DATA
+    ;
 %%
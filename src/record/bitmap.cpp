@@ -0,0 +1,49 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "bitmap.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+namespace {
+
+__attribute__((target("avx2"))) int skip_blocks_avx2(bool bit, const char *bm, int byte, int end_byte) {
+    const __m256i ones = _mm256_set1_epi8(static_cast<char>(0xff));
+    for (; end_byte - byte >= 32; byte += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bm + byte));
+        // 找1时全0的块可以跳过，找0时全1的块可以跳过
+        bool uniform = bit ? _mm256_testz_si256(block, block) : _mm256_testc_si256(block, ones);
+        if (!uniform) {
+            break;
+        }
+    }
+    return byte;
+}
+
+bool has_avx2() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }();
+    return supported;
+}
+
+}  // namespace
+
+int Bitmap::skip_blocks(bool bit, const char *bm, int byte, int end_byte) {
+    return has_avx2() ? skip_blocks_avx2(bit, bm, byte, end_byte) : byte;
+}
+
+#else
+
+int Bitmap::skip_blocks(bool bit, const char *bm, int byte, int end_byte) { return byte; }
+
+#endif
@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 
 static constexpr int BITMAP_WIDTH = 8;
 static constexpr unsigned BITMAP_HIGHEST_BIT = 0x80u;  // 128 (2^7)
+static constexpr int BITMAP_SIMD_MIN_BYTES = 64;        // 剩余的字节数不少于该值时，先用AVX2跳过不含目标位的32字节块
 
 class Bitmap {
    public:
@@ -31,7 +32,8 @@ class Bitmap {
     static bool is_set(const char *bm, int pos) { return (bm[get_bucket(pos)] & get_bit(pos)) != 0; }
 
     /**
-     * @brief 找下一个为0 or 1的位
+     * @brief 找下一个为0 or 1的位。每次读取8个字节，按大端序拼成64位的字，使第pos位对应字的第63 - pos % 64位，
+     * 用__builtin_clzll定位字中第一个目标位；剩余的字节较多时先用AVX2跳过不含目标位的32字节块
      * @param bit false表示要找下一个为0的位，true表示要找下一个为1的位
      * @param bm 要找的起始地址为bm
      * @param max_n 要找的从起始地址开始的偏移为[curr+1,max_n)
@@ -39,12 +41,27 @@ class Bitmap {
      * @return 找到了就返回偏移位置，没找到就返回max_n
      */
     static int next_bit(bool bit, const char *bm, int max_n, int curr) {
-        for (int i = curr + 1; i < max_n; i++) {
-            if (is_set(bm, i) == bit) {
-                return i;
+        int pos = curr + 1;
+        if (pos >= max_n) {
+            return max_n;
+        }
+        // 找0时把字取反，统一为找1；max_n之后的位取反后为1，找到时截断为max_n
+        uint64_t flip = bit ? 0 : ~static_cast<uint64_t>(0);
+        int end_byte = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        int byte = get_bucket(pos);
+        uint64_t word = (load_word(bm, byte, end_byte) ^ flip) & (~static_cast<uint64_t>(0) >> (pos % BITMAP_WIDTH));
+        while (word == 0) {
+            byte += 8;
+            if (byte >= end_byte) {
+                return max_n;
+            }
+            if (end_byte - byte >= BITMAP_SIMD_MIN_BYTES) {
+                byte = skip_blocks(bit, bm, byte, end_byte);
             }
+            word = load_word(bm, byte, end_byte) ^ flip;
         }
-        return max_n;
+        int found = byte * BITMAP_WIDTH + __builtin_clzll(word);
+        return found < max_n ? found : max_n;
     }
 
     // 找第一个为0 or 1的位
@@ -54,8 +71,28 @@ class Bitmap {
     // rid_.slot_no = Bitmap::next_bit(true, page_handle.bitmap, file_handle_->file_hdr_.num_records_per_page,
     // rid_.slot_no); int slot_no = Bitmap::first_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page);
 
+    /**
+     * @brief 从byte开始跳过所有位都不等于bit的32字节块，CPU不支持AVX2时不跳过
+     * @return 第一个可能含有目标位的块的起始字节，或者剩余不足一个块时剩余部分的起始字节
+     */
+    static int skip_blocks(bool bit, const char *bm, int byte, int end_byte);
+
    private:
     static int get_bucket(int pos) { return pos / BITMAP_WIDTH; }
 
     static char get_bit(int pos) { return BITMAP_HIGHEST_BIT >> static_cast<char>(pos % BITMAP_WIDTH); }
+
+    // 读取从byte开始的8个字节，第一个字节为最高位，超出end_byte的字节为0
+    static uint64_t load_word(const char *bm, int byte, int end_byte) {
+        uint64_t word = 0;
+        if (end_byte - byte >= 8) {
+            memcpy(&word, bm + byte, 8);
+        } else {
+            memcpy(&word, bm + byte, end_byte - byte);
+        }
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
 };
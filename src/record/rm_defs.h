@@ -10,6 +10,11 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "defs.h"
 #include "storage/buffer_pool_manager.h"
 
@@ -17,20 +22,54 @@ constexpr int RM_NO_PAGE = -1;
 constexpr int RM_FILE_HDR_PAGE = 0;
 constexpr int RM_FIRST_RECORD_PAGE = 1;
 constexpr int RM_MAX_RECORD_SIZE = 512;
+constexpr int RM_MAX_VAR_COLS = RM_MAX_RECORD_SIZE;  // 每个变长字段至少占1字节
+constexpr int RM_MAX_PAX_COLS = 256;  // PAX格式的表最多的字段个数，文件头放不下更多的字段位置
+constexpr int RM_MAX_ZONE_COLS = 16;  // 每个表最多维护页面摘要的字段个数
+constexpr int RM_MAX_ZONE_COL_LEN = 16;  // 长度超过它的CHAR字段不维护页面摘要，避免摘要项过大
+constexpr int RM_INSERT_TARGETS = 16;  // 每个表同时使用的插入目标页面个数，插入线程按id散列到其中一个
+const std::string RM_FSM_SUFFIX = ".fsm";  // 空闲空间映射文件的后缀
+const std::string RM_ZONE_MAP_SUFFIX = ".zm";  // 页面摘要文件的后缀
+
+/* 表数据文件的页面格式，建表时选定，之后不再改变 */
+enum RmFileFormat {
+    RM_FORMAT_BITMAP = 0,   // 定长slot + bitmap，每条记录占record_size字节
+    RM_FORMAT_SLOTTED = 1,  // 槽目录 + 变长记录，VARCHAR字段只存储实际长度
+    RM_FORMAT_PAX = 2       // bitmap + 每个字段一个minipage，同一字段的值在页面中连续存放，扫描可以只读部分字段
+};
+
+/* 字段在定长记录中的位置，slotted格式按变长字段的位置把定长记录编码为变长记录，PAX格式按每个字段的位置拆分记录 */
+struct RmVarCol {
+    uint16_t offset;  // 字段在定长记录中的偏移
+    uint16_t len;     // 字段的最大长度
+};
+
+/* 维护页面摘要(每个页面中的最小值和最大值)的字段 */
+struct RmZoneCol {
+    uint16_t offset;  // 字段在定长记录中的偏移
+    uint16_t len;     // 字段的长度
+    int type;         // 字段类型，取值为ColType，决定比较的方式
+};
 
 /* 文件头，记录表数据文件的元信息，写入磁盘中文件的第0号页面 */
 struct RmFileHdr {
-    int record_size;            // 表中每条记录的大小，由于不包含变长字段，因此当前字段初始化后保持不变
+    int record_size;            // 表中每条记录在内存中的定长大小，VARCHAR字段按最大长度计算
     int num_pages;              // 文件中分配的页面个数（初始化为1）
     int num_records_per_page;   // 每个页面最多能存储的元组个数
-    int first_free_page_no;     // 文件中当前第一个包含空闲空间的页面号（初始化为-1）
-    int bitmap_size;            // 每个页面bitmap大小
+    int bitmap_size;            // 每个页面bitmap大小，slotted格式为0
+    int format;                 // 页面格式，取值为RmFileFormat
+    int num_var_cols;           // 变长字段个数，只有slotted格式的表才有
+    RmVarCol var_cols[RM_MAX_VAR_COLS];  // 变长字段，按偏移升序排列
+    int num_pax_cols;           // 字段个数，只有PAX格式的表才有
+    RmVarCol pax_cols[RM_MAX_PAX_COLS];  // 所有字段，按偏移升序排列，依次覆盖整条记录
+    int num_zone_cols;          // 维护页面摘要的字段个数
+    RmZoneCol zone_cols[RM_MAX_ZONE_COLS];  // 维护页面摘要的字段
+    int is_clean;               // 文件上次是否正常关闭，打开期间磁盘上的文件头中为0
 };
 
 /* 表数据文件中每个页面的页头，记录每个页面的元信息 */
 struct RmPageHdr {
-    int next_free_page_no;  // 当前页面满了之后，下一个包含空闲空间的页面号（初始化为-1）
     int num_records;        // 当前页面中当前已经存储的记录个数（初始化为0）
+    int first_free_slot;    // 第一个空闲slot的下界，在它之前的slot都已被占用，插入记录时从这里开始找空闲slot（初始化为0）
 };
 
 /* 表中的记录 */
@@ -62,7 +101,7 @@ struct RmRecord {
         allocated_ = true;
     }
 
-    RmRecord(int size_, char* data_) {
+    RmRecord(int size_, const char* data_) {
         size = size_;
         data = new char[size_];
         memcpy(data, data_, size_);
@@ -90,3 +129,62 @@ struct RmRecord {
         data = nullptr;
     }
 };
+
+/**
+ * @description: 表中记录的只读视图，直接指向缓冲池帧中的记录数据，不复制记录。
+ * 视图在生命周期内持有所在页面的固定和读锁，析构或调用release()时释放；只能移动，不能复制。
+ * 由于持有读锁，同一线程在释放视图之前不能再对该页面加写锁，也不应跨算子调用长期持有视图；
+ * 需要在释放页面之后继续使用记录时，通过to_record()复制出一个RmRecord
+ */
+class RecordView {
+   public:
+    RecordView() = default;
+
+    RecordView(ReadPageGuard guard, const char* data, int size)
+        : guard_(std::move(guard)), data_(data), size_(size) {}
+
+    /* 记录在页面中是编码后的格式（例如slotted格式中的VARCHAR字段）时，视图持有解码后的记录，不持有页面 */
+    RecordView(std::unique_ptr<char[]> buf, int size) : buf_(std::move(buf)), data_(buf_.get()), size_(size) {}
+
+    RecordView(RecordView&& other) noexcept
+        : guard_(std::move(other.guard_)),
+          buf_(std::move(other.buf_)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    RecordView& operator=(RecordView&& other) noexcept {
+        if (this != &other) {
+            guard_ = std::move(other.guard_);
+            buf_ = std::move(other.buf_);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    RecordView(const RecordView&) = delete;
+    RecordView& operator=(const RecordView&) = delete;
+
+    bool is_valid() const { return data_ != nullptr; }
+
+    const char* data() const { return data_; }
+
+    int size() const { return size_; }
+
+    /* 释放页面的读锁和固定，之后视图不再可用 */
+    void release() {
+        guard_.drop();
+        buf_.reset();
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    /* 将视图中的记录复制为一个独立的RmRecord，用于需要物化记录的场景 */
+    std::unique_ptr<RmRecord> to_record() const { return std::make_unique<RmRecord>(size_, data_); }
+
+   private:
+    ReadPageGuard guard_;
+    std::unique_ptr<char[]> buf_;
+    const char* data_ = nullptr;
+    int size_ = 0;
+};
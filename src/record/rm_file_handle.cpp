@@ -10,6 +10,12 @@ See the Mulan PSL v2 for more details. */
 
 #include "rm_file_handle.h"
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <map>
+#include <thread>
+
 /**
  * @description: 获取当前表中记录号为rid的记录
  * @param {Rid&} rid 记录号，指定记录的位置
@@ -17,11 +23,97 @@ See the Mulan PSL v2 for more details. */
  * @return {unique_ptr<RmRecord>} rid对应的记录对象指针
  */
 std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid& rid, Context* context) const {
-    // Todo:
-    // 1. 获取指定记录所在的page handle
+    if (is_slotted()) {
+        const char* data;
+        int len;
+        ReadPageGuard guard = fetch_slotted_record(rid, &data, &len);
+        auto record = std::make_unique<RmRecord>(file_hdr_.record_size);
+        decode_record(data, len, record->data);
+        return record;
+    }
+    // 1. 获取指定记录所在的page handle，持有页面的读锁，其他读者可以并发读取同一页面
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
     // 2. 初始化一个指向RmRecord的指针（赋值其内部的data和size）
+    auto record = std::make_unique<RmRecord>(file_hdr_.record_size);
+    read_slot(page_handle, rid.slot_no, record->data);
+    return record;
+}
 
-    return nullptr;
+/**
+ * @description: 获取当前表中记录号为rid的记录的只读视图，视图直接指向缓冲池中的页面数据，不复制记录
+ * @param {Rid&} rid 记录号，指定记录的位置
+ * @param {Context*} context
+ * @return {RecordView} rid对应的记录视图，在视图释放之前持有页面的固定和读锁
+ */
+RecordView RmFileHandle::get_record_view(const Rid& rid, Context* context) const {
+    if (is_slotted()) {
+        const char* data;
+        int len;
+        ReadPageGuard guard = fetch_slotted_record(rid, &data, &len);
+        // 没有变长字段时编码后的记录就是定长记录，视图直接指向页面；否则视图持有解码后的记录
+        if (file_hdr_.num_var_cols == 0) {
+            return RecordView(std::move(guard), data, file_hdr_.record_size);
+        }
+        auto buf = std::make_unique<char[]>(file_hdr_.record_size);
+        decode_record(data, len, buf.get());
+        return RecordView(std::move(buf), file_hdr_.record_size);
+    }
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    // PAX格式的记录分散在各个minipage中，视图持有拼接后的记录
+    if (is_pax()) {
+        auto buf = std::make_unique<char[]>(file_hdr_.record_size);
+        read_slot(page_handle, rid.slot_no, buf.get());
+        return RecordView(std::move(buf), file_hdr_.record_size);
+    }
+    const char* data = page_handle.get_slot(rid.slot_no);
+    return RecordView(std::move(guard), data, file_hdr_.record_size);
+}
+
+/**
+ * @description: 只读取记录中指定字段的值，写到定长记录中字段各自的偏移处，out中其他字段的内容不变。
+ *              PAX格式只访问这些字段的minipage，其他格式的记录整条存放，读取整条记录
+ * @param {Rid&} rid 记录号
+ * @param {vector<RmVarCol>&} cols 要读取的字段在记录中的位置
+ * @param {char*} out 定长记录，长度为file_hdr_.record_size
+ */
+void RmFileHandle::get_record_cols(const Rid& rid, const std::vector<RmVarCol>& cols, char* out) const {
+    if (!is_pax()) {
+        auto record = get_record(rid, nullptr);
+        memcpy(out, record->data, file_hdr_.record_size);
+        return;
+    }
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    for (auto& col : cols) {
+        memcpy(out + col.offset, page_handle.get_pax_value(rid.slot_no, col), col.len);
+    }
+}
+
+/**
+ * @description: 判断指定位置上是否已经存在一条记录，bitmap格式通过Bitmap来判断，slotted格式通过槽目录来判断
+ * @param {Rid&} rid 记录号
+ * @return {bool} rid对应的位置上是否有记录
+ */
+bool RmFileHandle::is_record(const Rid& rid) const {
+    ReadPageGuard guard = fetch_page_read(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (is_slotted()) {
+        // 从其他页面移入的记录不是以这个位置为Rid的记录
+        RmSlottedPage page = page_handle.slotted();
+        return page.is_used(rid.slot_no) && !(page.get_flags(rid.slot_no) & RM_SLOT_MOVED);
+    }
+    return Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
 }
 
 /**
@@ -31,14 +123,45 @@ std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid& rid, Context* cont
  * @return {Rid} 插入的记录的记录号（位置）
  */
 Rid RmFileHandle::insert_record(char* buf, Context* context) {
-    // Todo:
-    // 1. 获取当前未满的page handle
-    // 2. 在page handle中找到空闲slot位置
-    // 3. 将buf复制到空闲slot位置
-    // 4. 更新page_handle.page_hdr中的数据结构
-    // 注意考虑插入一条记录后页面已满的情况，需要更新file_hdr_.first_free_page_no
+    // 1. 获取当前线程的插入目标页面，并持有其写锁直到插入完成
+    WritePageGuard guard = fetch_free_page(RM_NO_PAGE);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    guard.mark_dirty();
+    // 2. 在page handle中找到空闲位置并写入记录
+    int page_no = guard.get_page_id().page_no;
+    int slot_no = insert_into_page(page_handle, buf);
+    // 注意考虑插入一条记录后页面已满的情况，需要在空闲空间映射中清除该页面
+    if (is_page_full(page_handle)) {
+        fsm_.set_free(page_no, false);
+    }
+    return Rid{page_no, slot_no};
+}
 
-    return Rid{-1, -1};
+/**
+ * @description: 在当前表中批量插入多条记录，不指定插入位置。依次填满空闲页面，每个页面只pin和加写锁一次
+ * @param {char*} buf 要插入的记录的数据，多条定长记录依次存放
+ * @param {int} num_records 要插入的记录数量
+ * @param {vector<Rid>*} rids 插入的记录的记录号按buf中记录的顺序追加到其后；中途抛出异常时，
+ *                            已经插入的记录也在其中，调用者可以据此删除
+ * @param {Context*} context
+ */
+void RmFileHandle::insert_records(const char* buf, int num_records, std::vector<Rid>* rids, Context* context) {
+    size_t num_inserted = 0;
+    while (num_inserted < static_cast<size_t>(num_records)) {
+        WritePageGuard guard = fetch_free_page(RM_NO_PAGE);
+        RmPageHandle page_handle(&file_hdr_, guard.get_page());
+        guard.mark_dirty();
+        int page_no = guard.get_page_id().page_no;
+        // 有空闲空间的页面一定能再放下一条记录，插到页面满或者记录插完为止
+        do {
+            int slot_no = insert_into_page(page_handle, buf + num_inserted * file_hdr_.record_size);
+            rids->push_back(Rid{page_no, slot_no});
+            num_inserted++;
+        } while (num_inserted < static_cast<size_t>(num_records) && !is_page_full(page_handle));
+        if (is_page_full(page_handle)) {
+            fsm_.set_free(page_no, false);
+        }
+    }
 }
 
 /**
@@ -47,7 +170,27 @@ Rid RmFileHandle::insert_record(char* buf, Context* context) {
  * @param {char*} buf 要插入记录的数据
  */
 void RmFileHandle::insert_record(const Rid& rid, char* buf) {
-    
+    if (is_slotted()) {
+        insert_slotted_record(rid, buf);
+        return;
+    }
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    guard.mark_dirty();
+    bool was_full = is_page_full(page_handle);
+    // 记录全部被删除的页面会被释放，回滚删除时需要先把页面取回；被释放的页面在空闲空间映射中没有空闲空间
+    if (page_handle.page_hdr->num_records == 0 && disk_manager_->reclaim_page(fd_, rid.page_no)) {
+        Bitmap::init(page_handle.bitmap, file_hdr_.bitmap_size);
+        page_handle.page_hdr->first_free_slot = 0;
+        was_full = true;
+    }
+    zone_map_.update(rid.page_no, buf);
+    write_slot(page_handle, rid.slot_no, buf);
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        Bitmap::set(page_handle.bitmap, rid.slot_no);
+        page_handle.page_hdr->num_records++;
+    }
+    update_free_space(page_handle, was_full);
 }
 
 /**
@@ -56,10 +199,18 @@ void RmFileHandle::insert_record(const Rid& rid, char* buf) {
  * @param {Context*} context
  */
 void RmFileHandle::delete_record(const Rid& rid, Context* context) {
-    // Todo:
+    if (is_slotted()) {
+        delete_slotted_record(rid);
+        return;
+    }
     // 1. 获取指定记录所在的page handle
-    // 2. 更新page_handle.page_hdr中的数据结构
-    // 注意考虑删除一条记录后页面未满的情况，需要调用release_page_handle()
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    // 2. 更新page_handle.page_hdr中的数据结构，维护空闲空间映射
+    erase_slot(guard, page_handle, rid.slot_no);
 }
 
 
@@ -70,10 +221,182 @@ void RmFileHandle::delete_record(const Rid& rid, Context* context) {
  * @param {Context*} context
  */
 void RmFileHandle::update_record(const Rid& rid, char* buf, Context* context) {
-    // Todo:
+    if (is_slotted()) {
+        update_slotted_record(rid, buf);
+        return;
+    }
     // 1. 获取指定记录所在的page handle
-    // 2. 更新记录
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    if (!Bitmap::is_set(page_handle.bitmap, rid.slot_no)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    // 2. 更新记录，先扩大页面摘要
+    zone_map_.update(rid.page_no, buf);
+    write_slot(page_handle, rid.slot_no, buf);
+    guard.mark_dirty();
+}
+
+/**
+ * @description: 在线收缩表文件，截断文件末尾已经释放的页面
+ */
+void RmFileHandle::shrink_file() {
+    std::scoped_lock lock{hdr_latch_};
+    file_hdr_.num_pages -= disk_manager_->shrink_file(fd_);
+}
 
+/**
+ * @description: 在线整理表文件(VACUUM)。从最后一个页面开始，把每个页面中的记录移到页号更小的有空闲空间的页面中，
+ *              直到前面的页面放不下为止，清空的页面被释放，最后截断文件末尾已经释放的页面。
+ *              整理一个页面和截断文件期间持有relocation_latch_的排他锁，顺序扫描不会漏掉被移到前面的记录；
+ *              整理一个页面时只持有该页面、目标页面和转发涉及的页面的写锁，其他页面照常读写
+ * @param {function} on_move 每移动一条记录调用一次，参数为原来的Rid、新的Rid和记录数据，用于更新索引。
+ *                           调用时记录已经写入新位置、还没有从原位置删除，调用者持有原页面的写锁
+ * @return {int} 移动的记录条数
+ */
+int RmFileHandle::vacuum(const std::function<void(const Rid&, const Rid&, const char*)>& on_move) {
+    int num_moved = 0;
+    bool has_room = true;
+    for (int page_no = get_num_pages() - 1; has_room && page_no > RM_FIRST_RECORD_PAGE; page_no--) {
+        std::unique_lock relocation{relocation_latch_};
+        num_moved += vacuum_page(page_no, on_move, &has_room);
+    }
+    // 截断页面会改变页面数，同样要等正在进行的顺序扫描结束
+    std::unique_lock relocation{relocation_latch_};
+    shrink_file();
+    return num_moved;
+}
+
+/**
+ * @description: VACUUM整理一个页面，整个过程持有该页面的写锁，并发的更新和删除要么在整理之前完成，要么等整理结束后找不到原来的记录。
+ *              先把页面中的记录全部复制到页号更小的页面中，每个目标页面只写回一次；再调用on_move，
+ *              然后从原位置删除并写回原页面，变空的页面被释放(释放时写回)。slotted格式的记录移动后存放在新页面中，不再转发，
+ *              转发涉及的另一个页面只尝试加锁，写锁被占用时这条记录留在原处。
+ *              移动不写日志：目标页面在原页面被修改之前写回磁盘，故障时记录可能在新旧位置各有一份，但不会丢失
+ * @param {int} page_no 要整理的页面
+ * @param {function} on_move 同vacuum
+ * @param {bool*} has_room 传出参数，前面的页面放不下时置为false，页面中剩余的记录保持不动
+ * @return {int} 移动的记录条数
+ */
+int RmFileHandle::vacuum_page(int page_no, const std::function<void(const Rid&, const Rid&, const char*)>& on_move,
+                              bool* has_room) {
+    // 正在整理的页面不再接收新插入的记录
+    fsm_.set_free(page_no, false);
+    WritePageGuard guard = fetch_page_write(page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    int num_slots = is_slotted() ? page_handle.slotted().num_slots() : file_hdr_.num_records_per_page;
+
+    // 1. 复制到前面的页面中。other是slotted格式中转发涉及的另一个页面上的位置：
+    //    本页面的槽转发出去时为记录实际所在的位置，记录从其他页面移入时为记录原来的位置
+    struct MovedRecord {
+        int slot_no;
+        Rid rid;
+        Rid new_rid;
+        Rid other;
+    };
+    std::vector<MovedRecord> moved;
+    std::vector<char> bufs(static_cast<size_t>(num_slots) * file_hdr_.record_size);
+    std::map<int, WritePageGuard> other_guards;
+    std::vector<int> target_pages;
+    for (int slot_no = 0; slot_no < num_slots; slot_no++) {
+        char* buf = bufs.data() + moved.size() * file_hdr_.record_size;
+        MovedRecord rec{slot_no, Rid{page_no, slot_no}, Rid{RM_NO_PAGE, -1}, Rid{RM_NO_PAGE, -1}};
+        if (is_slotted()) {
+            RmSlottedPage page = page_handle.slotted();
+            if (!page.is_used(slot_no)) {
+                continue;
+            }
+            uint16_t flags = page.get_flags(slot_no);
+            if (flags & (RM_SLOT_FORWARD | RM_SLOT_MOVED)) {
+                memcpy(&rec.other, page.get_data(slot_no), sizeof(Rid));
+                auto it = other_guards.find(rec.other.page_no);
+                if (it == other_guards.end()) {
+                    WritePageGuard other_guard =
+                        buffer_pool_manager_->try_fetch_page_write(PageId{fd_, rec.other.page_no});
+                    if (!other_guard.is_valid()) {
+                        continue;
+                    }
+                    it = other_guards.emplace(rec.other.page_no, std::move(other_guard)).first;
+                }
+                RmSlottedPage other_page(it->second.get_page()->get_data());
+                // 另一端必须指回这个槽，否则是故障留下的孤立记录，不移动
+                Rid back{RM_NO_PAGE, -1};
+                uint16_t back_flags = flags & RM_SLOT_FORWARD ? RM_SLOT_MOVED : RM_SLOT_FORWARD;
+                if (other_page.is_used(rec.other.slot_no) && (other_page.get_flags(rec.other.slot_no) & back_flags)) {
+                    memcpy(&back, other_page.get_data(rec.other.slot_no), sizeof(Rid));
+                }
+                if (!(back == rec.rid)) {
+                    continue;
+                }
+                if (flags & RM_SLOT_FORWARD) {
+                    decode_record(other_page.get_data(rec.other.slot_no) + sizeof(Rid),
+                                  other_page.get_len(rec.other.slot_no) - static_cast<int>(sizeof(Rid)), buf);
+                } else {
+                    // 从其他页面移入的记录，从原位置整体移走
+                    std::swap(rec.rid, rec.other);
+                    decode_record(page.get_data(slot_no) + sizeof(Rid),
+                                  page.get_len(slot_no) - static_cast<int>(sizeof(Rid)), buf);
+                }
+            } else {
+                decode_record(page.get_data(slot_no), page.get_len(slot_no), buf);
+            }
+        } else {
+            if (!Bitmap::is_set(page_handle.bitmap, slot_no)) {
+                continue;
+            }
+            read_slot(page_handle, slot_no, buf);
+        }
+        WritePageGuard target_guard = fetch_free_page_below(page_no, page_no);
+        if (!target_guard.is_valid()) {
+            *has_room = false;
+            break;
+        }
+        RmPageHandle target_handle(&file_hdr_, target_guard.get_page());
+        target_guard.mark_dirty();
+        rec.new_rid = Rid{target_guard.get_page_id().page_no, insert_into_page(target_handle, buf)};
+        if (is_page_full(target_handle)) {
+            fsm_.set_free(rec.new_rid.page_no, false);
+        }
+        target_pages.push_back(rec.new_rid.page_no);
+        moved.push_back(rec);
+    }
+
+    // 2. 每个目标页面写回一次。已经被淘汰的页面在淘汰时写回过
+    std::sort(target_pages.begin(), target_pages.end());
+    target_pages.erase(std::unique(target_pages.begin(), target_pages.end()), target_pages.end());
+    for (int target_page_no : target_pages) {
+        buffer_pool_manager_->flush_page(PageId{fd_, target_page_no});
+    }
+
+    // 3. 从原位置删除，最后写回原页面和转发涉及的页面
+    for (size_t i = 0; i < moved.size(); i++) {
+        MovedRecord& rec = moved[i];
+        on_move(rec.rid, rec.new_rid, bufs.data() + i * file_hdr_.record_size);
+        if (!is_slotted()) {
+            erase_slot(guard, page_handle, rec.slot_no);
+            continue;
+        }
+        erase_slotted_record(guard, rec.slot_no);
+        if (rec.other.page_no != RM_NO_PAGE) {
+            const Rid& other = rec.rid.page_no == page_no ? rec.other : rec.rid;
+            erase_slotted_record(other_guards.at(other.page_no), other.slot_no);
+        }
+    }
+    for (auto& [other_page_no, other_guard] : other_guards) {
+        if (other_guard.is_valid()) {
+            buffer_pool_manager_->flush_page(other_guard.get_page_id());
+        }
+    }
+    if (guard.is_valid()) {
+        if (!moved.empty()) {
+            buffer_pool_manager_->flush_page(guard.get_page_id());
+        }
+        // 没有整理完的页面恢复在空闲空间映射中的状态
+        if (page_handle.page_hdr->num_records > 0) {
+            update_free_space(page_handle, true);
+        }
+    }
+    return static_cast<int>(moved.size());
 }
 
 /**
@@ -82,52 +405,593 @@ void RmFileHandle::update_record(const Rid& rid, char* buf, Context* context) {
 /**
  * @description: 获取指定页面的页面句柄
  * @param {int} page_no 页面号
+ * @param {BufferAccessStrategy*} strategy 缓冲区访问策略，大表的顺序扫描使用私有的帧环
  * @return {RmPageHandle} 指定页面的句柄
  */
-RmPageHandle RmFileHandle::fetch_page_handle(int page_no) const {
-    // Todo:
+RmPageHandle RmFileHandle::fetch_page_handle(int page_no, BufferAccessStrategy *strategy) const {
     // 使用缓冲池获取指定页面，并生成page_handle返回给上层
     // if page_no is invalid, throw PageNotExistError exception
+    if (page_no < RM_FIRST_RECORD_PAGE || page_no >= file_hdr_.num_pages) {
+        throw PageNotExistError(disk_manager_->get_file_name(fd_), page_no);
+    }
+    Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, page_no}, strategy);
+    if (page == nullptr) {
+        throw InternalError("RmFileHandle::fetch_page_handle Error");
+    }
+    return RmPageHandle(&file_hdr_, page);
+}
+
+/**
+ * @description: 获取指定页面并持有其读锁，页面号的检查与fetch_page_handle相同
+ * @param {int} page_no 页面号
+ * @return {ReadPageGuard} 持有读锁的页面，析构时自动unpin
+ */
+ReadPageGuard RmFileHandle::fetch_page_read(int page_no) const {
+    if (page_no < RM_FIRST_RECORD_PAGE || page_no >= file_hdr_.num_pages) {
+        throw PageNotExistError(disk_manager_->get_file_name(fd_), page_no);
+    }
+    ReadPageGuard guard = buffer_pool_manager_->fetch_page_read(PageId{fd_, page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmFileHandle::fetch_page_read Error");
+    }
+    return guard;
+}
+
+/**
+ * @description: 获取指定页面并持有其写锁，页面号的检查与fetch_page_handle相同
+ * @param {int} page_no 页面号
+ * @return {WritePageGuard} 持有写锁的页面，析构时自动unpin
+ */
+WritePageGuard RmFileHandle::fetch_page_write(int page_no) {
+    if (page_no < RM_FIRST_RECORD_PAGE || page_no >= get_num_pages()) {
+        throw PageNotExistError(disk_manager_->get_file_name(fd_), page_no);
+    }
+    WritePageGuard guard = buffer_pool_manager_->fetch_page_write(PageId{fd_, page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmFileHandle::fetch_page_write Error");
+    }
+    return guard;
+}
 
-    return RmPageHandle(&file_hdr_, nullptr);
+/**
+ * @description: 读取文件的页面个数，并发插入可能同时在创建新页面
+ */
+int RmFileHandle::get_num_pages() {
+    std::scoped_lock lock{hdr_latch_};
+    return file_hdr_.num_pages;
 }
 
 /**
- * @description: 创建一个新的page handle
- * @return {RmPageHandle} 新的PageHandle
+ * @description: 创建一个新页面并持有其写锁，新页面在空闲空间映射中标记为有空闲空间
+ * @return {WritePageGuard} 持有写锁的新页面
  */
-RmPageHandle RmFileHandle::create_new_page_handle() {
-    // Todo:
-    // 1.使用缓冲池来创建一个新page
+WritePageGuard RmFileHandle::create_new_page() {
+    // 1.使用缓冲池来创建一个新page，在其他线程从空闲空间映射中看到它之前持有写锁
+    PageId page_id{fd_, INVALID_PAGE_ID};
+    Page *page = buffer_pool_manager_->new_page(&page_id);
+    if (page == nullptr) {
+        throw InternalError("RmFileHandle::create_new_page Error");
+    }
+    page->WLatch();
+    WritePageGuard guard(buffer_pool_manager_, page);
+    guard.mark_dirty();
     // 2.更新page handle中的相关信息
-    // 3.更新file_hdr_
+    RmPageHandle page_handle(&file_hdr_, page);
+    page_handle.page_hdr->num_records = 0;
+    page_handle.page_hdr->first_free_slot = 0;
+    Bitmap::init(page_handle.bitmap, file_hdr_.bitmap_size);
+    if (is_slotted()) {
+        page_handle.slotted().init();
+    }
+    // 3.更新file_hdr_，新页面可能复用了文件中间已经释放的页号；在空闲空间映射中标记新页面
+    {
+        std::scoped_lock lock{hdr_latch_};
+        file_hdr_.num_pages = std::max(file_hdr_.num_pages, page_id.page_no + 1);
+    }
+    zone_map_.reset(page_id.page_no);
+    fsm_.set_free(page_id.page_no, true);
+    return guard;
+}
+
+/**
+ * @description: 获取一个页号小于limit_page_no的有空闲空间的页面并持有其写锁，VACUUM移动记录时使用。
+ *              总是使用页号最小的页面，包括文件中间已经释放的页面，移到前面的记录不会被再次移动；不会在文件末尾创建新页面
+ * @param {int} limit_page_no 只返回页号小于它的页面
+ * @param {int} exclude_page_no 调用者已经持有写锁的页面，不能返回该页面；写锁被占用的页面直接跳过
+ * @return {WritePageGuard} 持有写锁的页面，找不到时返回无效的守卫
+ */
+WritePageGuard RmFileHandle::fetch_free_page_below(int limit_page_no, int exclude_page_no) {
+    page_id_t free_page_no = disk_manager_->get_min_free_page(fd_);
+    if (free_page_no == exclude_page_no) {
+        free_page_no = INVALID_PAGE_ID;
+    }
+    int fsm_limit = free_page_no != INVALID_PAGE_ID ? std::min(free_page_no, limit_page_no) : limit_page_no;
+    int start = RM_FIRST_RECORD_PAGE;
+    while (true) {
+        int page_no = fsm_.find_free_page(start, exclude_page_no, fsm_limit);
+        if (page_no == RM_NO_PAGE || page_no < start) {
+            break;
+        }
+        WritePageGuard guard = fetch_second_page_write(page_no, exclude_page_no);
+        if (guard.is_valid()) {
+            RmPageHandle page_handle(&file_hdr_, guard.get_page());
+            if (!is_page_full(page_handle) && fsm_.is_free(page_no)) {
+                return guard;
+            }
+            if (is_page_full(page_handle) && fsm_.is_free(page_no)) {
+                fsm_.set_free(page_no, false);
+            }
+        }
+        start = page_no + 1;
+    }
+    if (free_page_no == INVALID_PAGE_ID || free_page_no >= limit_page_no) {
+        return WritePageGuard();
+    }
+    // 并发的插入者可能先取走了这个页号，新页面分配在别处也只是少整理一些，记录仍然可以放在新页面中
+    return create_new_page();
+}
 
-    return RmPageHandle(&file_hdr_, nullptr);
+/**
+ * @description: 获取一个有空闲空间的页面并持有其写锁，用于插入记录。
+ *              每个线程按id散列到一个插入目标，优先使用目标页面，目标页面满了之后从空闲空间映射中查找下一个页面，
+ *              没有目标的线程从文件中与之对应的位置开始查找，并发的插入者因此分散在不同的页面上；
+ *              找不到时创建新页面。加锁之后再次检查页面，避免使用刚被其他线程插满或释放的页面
+ * @param {int} exclude_page_no 调用者已经持有写锁的页面，不能返回该页面，页号比它小且写锁被占用的页面直接跳过；
+ *                              没有时为RM_NO_PAGE
+ * @return {WritePageGuard} 持有写锁的页面
+ */
+WritePageGuard RmFileHandle::fetch_free_page(int exclude_page_no) {
+    size_t target_no = std::hash<std::thread::id>{}(std::this_thread::get_id()) % RM_INSERT_TARGETS;
+    std::atomic<int>& target = insert_targets_[target_no];
+    int num_pages = get_num_pages();
+    int page_no = target.load(std::memory_order_relaxed);
+    int start = page_no != RM_NO_PAGE
+                    ? page_no
+                    : RM_FIRST_RECORD_PAGE + static_cast<int>((num_pages - 1) * target_no / RM_INSERT_TARGETS);
+    for (int attempt = 0; attempt < RM_INSERT_TARGETS; attempt++) {
+        if (page_no == RM_NO_PAGE || page_no == exclude_page_no || page_no >= num_pages || !fsm_.is_free(page_no)) {
+            page_no = fsm_.find_free_page(start, exclude_page_no, num_pages);
+            if (page_no == RM_NO_PAGE) {
+                break;
+            }
+        }
+        WritePageGuard guard = exclude_page_no == RM_NO_PAGE ? fetch_page_write(page_no)
+                                                             : fetch_second_page_write(page_no, exclude_page_no);
+        if (guard.is_valid()) {
+            RmPageHandle page_handle(&file_hdr_, guard.get_page());
+            if (!is_page_full(page_handle) && fsm_.is_free(page_no)) {
+                target.store(page_no, std::memory_order_relaxed);
+                return guard;
+            }
+            // 映射中的空闲标记已经过时，持有写锁时清除，之后的插入不再访问这个页面
+            if (is_page_full(page_handle) && fsm_.is_free(page_no)) {
+                fsm_.set_free(page_no, false);
+            }
+        }
+        start = page_no + 1;
+        page_no = RM_NO_PAGE;
+    }
+    WritePageGuard guard = create_new_page();
+    target.store(guard.get_page_id().page_no, std::memory_order_relaxed);
+    return guard;
 }
 
 /**
- * @brief 创建或获取一个空闲的page handle
- *
- * @return RmPageHandle 返回生成的空闲page handle
- * @note pin the page, remember to unpin it outside!
+ * @description: 已经持有一个页面的写锁时获取另一个页面的写锁。同时持有两个页面时按页号从小到大加锁：
+ *              页号更大时直接等待；页号更小时只尝试加锁，写锁被占用时返回无效的守卫，
+ *              调用者换一个页面，或者释放已经持有的页面后按页号顺序重新加锁
+ * @param {int} page_no 要获取的页面号
+ * @param {int} held_page_no 调用者已经持有写锁的页面号
+ * @return {WritePageGuard} 持有写锁的页面，可能无效
  */
-RmPageHandle RmFileHandle::create_page_handle() {
-    // Todo:
-    // 1. 判断file_hdr_中是否还有空闲页
-    //     1.1 没有空闲页：使用缓冲池来创建一个新page；可直接调用create_new_page_handle()
-    //     1.2 有空闲页：直接获取第一个空闲页
-    // 2. 生成page handle并返回给上层
+WritePageGuard RmFileHandle::fetch_second_page_write(int page_no, int held_page_no) {
+    if (page_no > held_page_no) {
+        return fetch_page_write(page_no);
+    }
+    if (page_no < RM_FIRST_RECORD_PAGE || page_no >= get_num_pages()) {
+        throw PageNotExistError(disk_manager_->get_file_name(fd_), page_no);
+    }
+    return buffer_pool_manager_->try_fetch_page_write(PageId{fd_, page_no});
+}
 
-    return RmPageHandle(&file_hdr_, nullptr);
+/**
+ * @description: 持有slotted格式的记录所在页面的写锁时，获取记录转发到的页面的写锁。
+ *              转发到的页面号更小且写锁被占用时，释放原页面后按页号顺序重新获取两个页面，
+ *              期间记录可能被并发更新或删除，原位置不再转发到target时返回false，调用者释放两个页面后重试
+ * @param {Rid&} rid 记录原来的位置，guard持有其所在页面的写锁
+ * @param {Rid&} target 记录转发到的位置
+ * @param {WritePageGuard&} guard 原页面的守卫，可能被重新获取，调用者需要重新读取页面
+ * @param {WritePageGuard*} target_guard 传出参数，转发到的页面的守卫
+ * @return {bool} 两个页面都持有写锁且记录仍然转发到target时返回true
+ */
+bool RmFileHandle::fetch_forward_page(const Rid& rid, const Rid& target, WritePageGuard& guard,
+                                      WritePageGuard* target_guard) {
+    *target_guard = fetch_second_page_write(target.page_no, rid.page_no);
+    if (target_guard->is_valid()) {
+        return true;
+    }
+    guard.drop();
+    *target_guard = fetch_page_write(target.page_no);
+    guard = fetch_page_write(rid.page_no);
+    RmSlottedPage page(guard.get_page()->get_data());
+    Rid cur{RM_NO_PAGE, -1};
+    if (page.is_used(rid.slot_no) && (page.get_flags(rid.slot_no) & RM_SLOT_FORWARD)) {
+        memcpy(&cur, page.get_data(rid.slot_no), sizeof(Rid));
+    }
+    return cur == target;
 }
 
 /**
- * @description: 当一个页面从没有空闲空间的状态变为有空闲空间状态时，更新文件头和页头中空闲页面相关的元数据
+ * @description: 判断页面是否已满。bitmap格式的页面所有slot都被占用时已满；slotted格式的页面放不下一条最长的记录
+ *               （包括移入时记录原位置的Rid）时视为已满，保证有空闲空间的页面一定能插入任意一条记录
  */
-void RmFileHandle::release_page_handle(RmPageHandle&page_handle) {
-    // Todo:
-    // 当page从已满变成未满，考虑如何更新：
-    // 1. page_handle.page_hdr->next_free_page_no
-    // 2. file_hdr_.first_free_page_no
-    
-}
\ No newline at end of file
+bool RmFileHandle::is_page_full(const RmPageHandle& page_handle) const {
+    if (is_slotted()) {
+        int max_len = file_hdr_.record_size + file_hdr_.num_var_cols * static_cast<int>(sizeof(uint16_t)) +
+                      static_cast<int>(sizeof(Rid));
+        return !page_handle.slotted().has_room(max_len);
+    }
+    return page_handle.page_hdr->num_records == file_hdr_.num_records_per_page;
+}
+
+/**
+ * @description: 页面中的记录变化后，根据页面是否已满的变化维护空闲空间映射，调用者持有页面的写锁
+ * @param {bool} was_full 变化之前页面是否已满
+ */
+void RmFileHandle::update_free_space(RmPageHandle& page_handle, bool was_full) {
+    bool is_full = is_page_full(page_handle);
+    if (was_full != is_full) {
+        fsm_.set_free(page_handle.page->get_page_id().page_no, !is_full);
+    }
+}
+
+/**
+ * @description: 删除记录后维护空闲空间映射。页面中的记录全部被删除时释放页面，页号归还给disk_manager以便复用，
+ *              释放之前先在映射中清除该页面并清空页面摘要，避免其他线程把记录插入已经释放的页面；
+ *              页面仍被其他线程(例如顺序扫描)固定时不能释放，重新标记为有空闲空间
+ * @param {WritePageGuard&} guard 持有页面写锁的守卫，页面被释放时守卫不再持有页面
+ * @param {bool} was_full 删除之前页面是否已满
+ */
+void RmFileHandle::free_page_if_empty(WritePageGuard& guard, RmPageHandle& page_handle, bool was_full) {
+    int page_no = guard.get_page_id().page_no;
+    if (page_handle.page_hdr->num_records == 0) {
+        fsm_.set_free(page_no, false);
+        zone_map_.reset(page_no);
+        if (buffer_pool_manager_->free_page(guard)) {
+            return;
+        }
+        was_full = true;
+    }
+    update_free_space(page_handle, was_full);
+}
+
+/**
+ * @description: 把定长记录编码为slotted格式的变长记录：先按偏移顺序存放所有定长字段，
+ *               再依次存放每个变长字段的实际长度(uint16_t)和内容，去掉VARCHAR字段末尾补齐的0
+ * @param {char*} buf 定长记录，长度为file_hdr_.record_size
+ * @param {char*} out 编码后的记录，长度不超过RM_MAX_SLOTTED_TUPLE
+ * @return {int} 编码后的记录长度
+ */
+int RmFileHandle::encode_record(const char* buf, char* out) const {
+    int pos = 0;
+    int prev = 0;
+    for (int i = 0; i < file_hdr_.num_var_cols; i++) {
+        const RmVarCol& col = file_hdr_.var_cols[i];
+        memcpy(out + pos, buf + prev, col.offset - prev);
+        pos += col.offset - prev;
+        prev = col.offset + col.len;
+    }
+    memcpy(out + pos, buf + prev, file_hdr_.record_size - prev);
+    pos += file_hdr_.record_size - prev;
+    for (int i = 0; i < file_hdr_.num_var_cols; i++) {
+        const RmVarCol& col = file_hdr_.var_cols[i];
+        uint16_t len = strnlen(buf + col.offset, col.len);
+        memcpy(out + pos, &len, sizeof(len));
+        memcpy(out + pos + sizeof(len), buf + col.offset, len);
+        pos += sizeof(len) + len;
+    }
+    return pos;
+}
+
+/**
+ * @description: 把slotted格式的变长记录解码为定长记录，VARCHAR字段用0补齐到最大长度
+ * @param {char*} src 编码后的记录
+ * @param {int} len 编码后的记录长度
+ * @param {char*} out 定长记录，长度为file_hdr_.record_size
+ */
+void RmFileHandle::decode_record(const char* src, int len, char* out) const {
+    int pos = 0;
+    int prev = 0;
+    for (int i = 0; i < file_hdr_.num_var_cols; i++) {
+        const RmVarCol& col = file_hdr_.var_cols[i];
+        memcpy(out + prev, src + pos, col.offset - prev);
+        pos += col.offset - prev;
+        prev = col.offset + col.len;
+    }
+    memcpy(out + prev, src + pos, file_hdr_.record_size - prev);
+    pos += file_hdr_.record_size - prev;
+    for (int i = 0; i < file_hdr_.num_var_cols; i++) {
+        const RmVarCol& col = file_hdr_.var_cols[i];
+        uint16_t var_len;
+        memcpy(&var_len, src + pos, sizeof(var_len));
+        memcpy(out + col.offset, src + pos + sizeof(var_len), var_len);
+        memset(out + col.offset + var_len, 0, col.len - var_len);
+        pos += sizeof(var_len) + var_len;
+    }
+    assert(pos == len);
+}
+
+/**
+ * @description: 获取slotted格式的记录所在的页面并持有其读锁。记录被移到其他页面时，先释放原页面，再沿转发的Rid获取新页面。
+ *              释放原页面期间新位置上的记录可能被并发的更新、删除或VACUUM删除，槽也可能被其他记录复用，
+ *              因此获取新页面后检查槽中仍是rid移过来的记录，否则从原页面重新读取
+ * @param {Rid&} rid 记录号
+ * @param {char**} data 返回编码后的记录
+ * @param {int*} len 返回编码后的记录长度
+ * @return {ReadPageGuard} 记录所在的页面
+ */
+ReadPageGuard RmFileHandle::fetch_slotted_record(const Rid& rid, const char** data, int* len) const {
+    while (true) {
+        ReadPageGuard guard = fetch_page_read(rid.page_no);
+        RmSlottedPage page(guard.get_page()->get_data());
+        if (!page.is_used(rid.slot_no) || (page.get_flags(rid.slot_no) & RM_SLOT_MOVED)) {
+            throw RecordNotFoundError(rid.page_no, rid.slot_no);
+        }
+        if (!(page.get_flags(rid.slot_no) & RM_SLOT_FORWARD)) {
+            *data = page.get_data(rid.slot_no);
+            *len = page.get_len(rid.slot_no);
+            return guard;
+        }
+        Rid target;
+        memcpy(&target, page.get_data(rid.slot_no), sizeof(Rid));
+        guard.drop();
+        guard = fetch_page_read(target.page_no);
+        page = RmSlottedPage(guard.get_page()->get_data());
+        Rid back{RM_NO_PAGE, -1};
+        if (page.is_used(target.slot_no) && (page.get_flags(target.slot_no) & RM_SLOT_MOVED)) {
+            memcpy(&back, page.get_data(target.slot_no), sizeof(Rid));
+        }
+        if (back == rid) {
+            *data = page.get_data(target.slot_no) + sizeof(Rid);
+            *len = page.get_len(target.slot_no) - static_cast<int>(sizeof(Rid));
+            return guard;
+        }
+    }
+}
+
+/**
+ * @description: 读出bitmap或PAX格式页面中一个slot上的定长记录，PAX格式从每个字段的minipage中拼接
+ * @param {int} slot_no slot号
+ * @param {char*} out 定长记录，长度为file_hdr_.record_size
+ */
+void RmFileHandle::read_slot(const RmPageHandle& page_handle, int slot_no, char* out) const {
+    if (!is_pax()) {
+        memcpy(out, page_handle.get_slot(slot_no), file_hdr_.record_size);
+        return;
+    }
+    for (int i = 0; i < file_hdr_.num_pax_cols; i++) {
+        const RmVarCol& col = file_hdr_.pax_cols[i];
+        memcpy(out + col.offset, page_handle.get_pax_value(slot_no, col), col.len);
+    }
+}
+
+/**
+ * @description: 把定长记录写到bitmap或PAX格式页面中的一个slot上，PAX格式把每个字段写到各自的minipage中
+ * @param {int} slot_no slot号
+ * @param {char*} buf 定长记录，长度为file_hdr_.record_size
+ */
+void RmFileHandle::write_slot(RmPageHandle& page_handle, int slot_no, const char* buf) const {
+    if (!is_pax()) {
+        memcpy(page_handle.get_slot(slot_no), buf, file_hdr_.record_size);
+        return;
+    }
+    for (int i = 0; i < file_hdr_.num_pax_cols; i++) {
+        const RmVarCol& col = file_hdr_.pax_cols[i];
+        memcpy(page_handle.get_pax_value(slot_no, col), buf + col.offset, col.len);
+    }
+}
+
+/**
+ * @description: 在一个未满且已经加写锁的页面中插入一条记录，不维护空闲空间映射
+ * @param {char*} buf 定长记录
+ * @return {int} 插入的slot号
+ */
+int RmFileHandle::insert_into_page(RmPageHandle& page_handle, const char* buf) {
+    if (is_slotted()) {
+        char tuple[RM_MAX_SLOTTED_TUPLE];
+        int len = encode_record(buf, tuple);
+        zone_map_.update(page_handle.page->get_page_id().page_no, buf);
+        int slot_no = page_handle.slotted().insert(tuple, len, 0);
+        if (slot_no < 0) {
+            throw InternalError("RmFileHandle::insert_into_page Error");
+        }
+        return slot_no;
+    }
+    int slot_no = Bitmap::next_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page,
+                                   page_handle.page_hdr->first_free_slot - 1);
+    zone_map_.update(page_handle.page->get_page_id().page_no, buf);
+    write_slot(page_handle, slot_no, buf);
+    Bitmap::set(page_handle.bitmap, slot_no);
+    page_handle.page_hdr->num_records++;
+    page_handle.page_hdr->first_free_slot = slot_no + 1;
+    return slot_no;
+}
+
+/**
+ * @description: 删除bitmap格式或PAX格式页面中的一个slot并维护空闲空间映射。
+ *              页面中的记录全部被删除时释放页面，页号归还给disk_manager以便复用
+ * @param {WritePageGuard&} guard 持有页面写锁的守卫，页面被释放时守卫不再持有页面
+ * @param {int} slot_no slot号
+ */
+void RmFileHandle::erase_slot(WritePageGuard& guard, RmPageHandle& page_handle, int slot_no) {
+    guard.mark_dirty();
+    bool was_full = is_page_full(page_handle);
+    Bitmap::reset(page_handle.bitmap, slot_no);
+    page_handle.page_hdr->num_records--;
+    page_handle.page_hdr->first_free_slot = std::min(page_handle.page_hdr->first_free_slot, slot_no);
+    free_page_if_empty(guard, page_handle, was_full);
+}
+
+/**
+ * @description: 在一个有空闲空间的页面中插入一条编码后的记录
+ * @param {char*} data 编码后的记录
+ * @param {int} len 编码后的记录长度
+ * @param {uint16_t} flags 槽的标志位
+ * @param {int} exclude_page_no 调用者已经持有写锁的页面，不能插入该页面，避免重复加锁
+ * @return {Rid} 插入的位置
+ */
+Rid RmFileHandle::insert_slotted_record(const char* data, int len, uint16_t flags, int exclude_page_no) {
+    WritePageGuard guard = fetch_free_page(exclude_page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    guard.mark_dirty();
+    int page_no = guard.get_page_id().page_no;
+    int slot_no = page_handle.slotted().insert(data, len, flags);
+    if (slot_no < 0) {
+        throw InternalError("RmFileHandle::insert_slotted_record Error");
+    }
+    if (is_page_full(page_handle)) {
+        fsm_.set_free(page_no, false);
+    }
+    return Rid{page_no, slot_no};
+}
+
+/**
+ * @description: 在指定位置插入一条slotted格式的记录，用于回滚删除和故障恢复。
+ *               该位置上已经有记录时按更新处理；页面放不下时记录存放到其他页面，该位置只保留转发的Rid
+ */
+void RmFileHandle::insert_slotted_record(const Rid& rid, char* buf) {
+    char tuple[RM_MAX_SLOTTED_TUPLE];
+    int len = encode_record(buf, tuple);
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    RmSlottedPage page = page_handle.slotted();
+    guard.mark_dirty();
+    bool was_full = is_page_full(page_handle);
+    // 记录全部被删除的页面会被释放，回滚删除时需要先把页面取回；被释放的页面在空闲空间映射中没有空闲空间
+    if (page_handle.page_hdr->num_records == 0 && disk_manager_->reclaim_page(fd_, rid.page_no)) {
+        page.init();
+        was_full = true;
+    }
+    if (page.is_used(rid.slot_no)) {
+        if (page.get_flags(rid.slot_no) & RM_SLOT_MOVED) {
+            throw InternalError("RmFileHandle::insert_record: slot is occupied by a moved record");
+        }
+        guard.drop();
+        update_slotted_record(rid, buf);
+        return;
+    }
+    // 记录被移到其他页面时页面摘要仍然算在原页面上，扫描在原位置上返回该记录
+    zone_map_.update(rid.page_no, buf);
+    if (!page.insert_at(rid.slot_no, tuple, len, 0)) {
+        // 先占住这个槽，保证转发的Rid放得下，再把记录存放到其他页面
+        Rid target{RM_NO_PAGE, -1};
+        if (!page.insert_at(rid.slot_no, reinterpret_cast<const char*>(&target), sizeof(Rid), RM_SLOT_FORWARD)) {
+            throw InternalError("RmFileHandle::insert_record: page is full");
+        }
+        char moved[RM_MAX_SLOTTED_TUPLE];
+        memcpy(moved, &rid, sizeof(Rid));
+        memcpy(moved + sizeof(Rid), tuple, len);
+        target = insert_slotted_record(moved, len + sizeof(Rid), RM_SLOT_MOVED, rid.page_no);
+        page.update(rid.slot_no, reinterpret_cast<const char*>(&target), sizeof(Rid), RM_SLOT_FORWARD);
+    }
+    update_free_space(page_handle, was_full);
+}
+
+/**
+ * @description: 删除一条slotted格式的记录，记录被移到其他页面时同时删除新位置上的记录
+ */
+void RmFileHandle::delete_slotted_record(const Rid& rid) {
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmSlottedPage page(guard.get_page()->get_data());
+    if (!page.is_used(rid.slot_no) || (page.get_flags(rid.slot_no) & RM_SLOT_MOVED)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    Rid target{RM_NO_PAGE, -1};
+    if (page.get_flags(rid.slot_no) & RM_SLOT_FORWARD) {
+        memcpy(&target, page.get_data(rid.slot_no), sizeof(Rid));
+    }
+    erase_slotted_record(guard, rid.slot_no);
+    if (target.page_no != RM_NO_PAGE) {
+        guard.drop();
+        WritePageGuard target_guard = fetch_page_write(target.page_no);
+        erase_slotted_record(target_guard, target.slot_no);
+    }
+}
+
+/**
+ * @description: 更新一条slotted格式的记录，Rid保持不变。
+ *               原页面放得下新记录时存放在原位置（记录原来被移走时顺便移回）；否则记录存放到其他页面，
+ *               原位置只保留转发的Rid，转发最多一跳。同时最多持有两个页面的写锁，按页号从小到大加锁，
+ *               互相转发的两条记录被并发更新时不会死锁
+ */
+void RmFileHandle::update_slotted_record(const Rid& rid, char* buf) {
+    char tuple[RM_MAX_SLOTTED_TUPLE];
+    int len = encode_record(buf, tuple);
+    WritePageGuard guard = fetch_page_write(rid.page_no);
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    RmSlottedPage page = page_handle.slotted();
+    if (!page.is_used(rid.slot_no) || (page.get_flags(rid.slot_no) & RM_SLOT_MOVED)) {
+        throw RecordNotFoundError(rid.page_no, rid.slot_no);
+    }
+    guard.mark_dirty();
+    bool was_full = is_page_full(page_handle);
+    Rid target{RM_NO_PAGE, -1};
+    if (page.get_flags(rid.slot_no) & RM_SLOT_FORWARD) {
+        memcpy(&target, page.get_data(rid.slot_no), sizeof(Rid));
+    }
+    zone_map_.update(rid.page_no, buf);
+    // 1. 原页面放得下新记录
+    if (page.update(rid.slot_no, tuple, len, 0)) {
+        update_free_space(page_handle, was_full);
+        if (target.page_no != RM_NO_PAGE) {
+            guard.drop();
+            WritePageGuard target_guard = fetch_page_write(target.page_no);
+            erase_slotted_record(target_guard, target.slot_no);
+        }
+        return;
+    }
+    // 2. 记录已经被移走，先尝试在新位置上更新
+    char moved[RM_MAX_SLOTTED_TUPLE];
+    memcpy(moved, &rid, sizeof(Rid));
+    memcpy(moved + sizeof(Rid), tuple, len);
+    int moved_len = len + sizeof(Rid);
+    if (target.page_no != RM_NO_PAGE) {
+        WritePageGuard target_guard;
+        if (!fetch_forward_page(rid, target, guard, &target_guard)) {
+            target_guard.drop();
+            guard.drop();
+            update_slotted_record(rid, buf);
+            return;
+        }
+        // 可能重新获取过原页面的写锁
+        page_handle = RmPageHandle(&file_hdr_, guard.get_page());
+        page = page_handle.slotted();
+        guard.mark_dirty();
+        was_full = is_page_full(page_handle);
+        RmPageHandle target_handle(&file_hdr_, target_guard.get_page());
+        target_guard.mark_dirty();
+        bool target_was_full = is_page_full(target_handle);
+        if (target_handle.slotted().update(target.slot_no, moved, moved_len, RM_SLOT_MOVED)) {
+            update_free_space(target_handle, target_was_full);
+            return;
+        }
+        erase_slotted_record(target_guard, target.slot_no);
+    }
+    // 3. 把记录存放到其他页面，原位置只保留转发的Rid。转发的Rid不长于原来的记录，一定能原地更新
+    target = insert_slotted_record(moved, moved_len, RM_SLOT_MOVED, rid.page_no);
+    page.update(rid.slot_no, reinterpret_cast<const char*>(&target), sizeof(Rid), RM_SLOT_FORWARD);
+    update_free_space(page_handle, was_full);
+}
+
+/**
+ * @description: 删除slotted格式页面中的一个槽并维护空闲空间映射，页面变空时与bitmap格式一样释放页面
+ * @param {WritePageGuard&} guard 持有页面写锁的守卫，页面被释放时守卫不再持有页面
+ * @param {int} slot_no 槽号
+ */
+void RmFileHandle::erase_slotted_record(WritePageGuard& guard, int slot_no) {
+    RmPageHandle page_handle(&file_hdr_, guard.get_page());
+    guard.mark_dirty();
+    bool was_full = is_page_full(page_handle);
+    page_handle.slotted().erase(slot_no);
+    free_page_if_empty(guard, page_handle, was_full);
+}
@@ -12,11 +12,20 @@ See the Mulan PSL v2 for more details. */
 
 #include <assert.h>
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "bitmap.h"
 #include "common/context.h"
 #include "rm_defs.h"
+#include "rm_free_space_map.h"
+#include "rm_slotted_page.h"
+#include "rm_zone_map.h"
 
 class RmManager;
 
@@ -38,6 +47,60 @@ struct RmPageHandle {
     char* get_slot(int slot_no) const {
         return slots + slot_no * file_hdr->record_size;  // slots的首地址 + slot个数 * 每个slot的大小(每个record的大小)
     }
+
+    // PAX格式的页面中，第i个字段的minipage从slots + n * 字段偏移处开始，依次存放n个该字段的值，n为每页的记录数
+    char* get_pax_value(int slot_no, const RmVarCol &col) const {
+        return slots + file_hdr->num_records_per_page * col.offset + slot_no * col.len;
+    }
+
+    // slotted格式的页面没有bitmap，页头之后是槽目录和记录区，通过slotted()访问
+    RmSlottedPage slotted() const { return RmSlottedPage(page->get_data()); }
+};
+
+/**
+ * 顺序扫描与VACUUM移动记录之间的同步。记录可能从扫描还没有到达的页面移到已经扫描过的页面，
+ * 因此VACUUM只在没有扫描进行时移动记录，扫描开始时等待正在进行的移动结束。
+ * 满足SharedMutex的接口：扫描持有共享锁，移动记录持有排他锁。
+ * 同一线程可以同时持有多个扫描(例如自连接)，所以不使用std::shared_mutex，并且等待中的移动不阻塞新的扫描
+ */
+class RmRelocationLatch {
+   public:
+    void lock() {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] { return num_scans_ == 0 && !relocating_; });
+        relocating_ = true;
+    }
+
+    void unlock() {
+        {
+            std::scoped_lock lock{mutex_};
+            relocating_ = false;
+        }
+        cv_.notify_all();
+    }
+
+    void lock_shared() {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] { return !relocating_; });
+        num_scans_++;
+    }
+
+    void unlock_shared() {
+        bool last;
+        {
+            std::scoped_lock lock{mutex_};
+            last = --num_scans_ == 0;
+        }
+        if (last) {
+            cv_.notify_all();
+        }
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int num_scans_ = 0;       // 正在进行的扫描个数
+    bool relocating_ = false; // 是否正在移动记录
 };
 
 /* 每个RmFileHandle对应一个表的数据文件，里面有多个page，每个page的数据封装在RmPageHandle中 */
@@ -50,43 +113,110 @@ class RmFileHandle {
     BufferPoolManager *buffer_pool_manager_;
     int fd_;        // 打开文件后产生的文件句柄
     RmFileHdr file_hdr_;    // 文件头，维护当前表文件的元数据
+    RmFreeSpaceMap fsm_;    // 空闲空间映射，记录哪些页面还能插入记录
+    RmZoneMap zone_map_;    // 页面摘要，记录每个页面中摘要字段的最小值和最大值
+    std::mutex hdr_latch_;  // 并发插入创建新页面时保护file_hdr_.num_pages
+    std::array<std::atomic<int>, RM_INSERT_TARGETS> insert_targets_;  // 插入线程当前使用的目标页面
+    mutable RmRelocationLatch relocation_latch_;  // 顺序扫描期间持有共享锁，VACUUM移动记录时持有排他锁
 
    public:
-    RmFileHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
-        : disk_manager_(disk_manager), buffer_pool_manager_(buffer_pool_manager), fd_(fd) {
+    RmFileHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd, int fsm_fd, int zm_fd)
+        : disk_manager_(disk_manager),
+          buffer_pool_manager_(buffer_pool_manager),
+          fd_(fd),
+          fsm_(disk_manager, buffer_pool_manager, fsm_fd),
+          zone_map_(disk_manager, buffer_pool_manager, zm_fd, &file_hdr_) {
         // 注意：这里从磁盘中读出文件描述符为fd的文件的file_hdr，读到内存中
         // 这里实际就是初始化file_hdr，只不过是从磁盘中读出进行初始化
         // init file_hdr_
         disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
         // disk_manager管理的fd对应的文件中，设置从file_hdr_.num_pages开始分配page_no
         disk_manager_->set_fd2pageno(fd, file_hdr_.num_pages);
+        for (auto &target : insert_targets_) {
+            target.store(RM_NO_PAGE, std::memory_order_relaxed);
+        }
     }
 
-    RmFileHdr get_file_hdr() { return file_hdr_; }
+    const RmFileHdr &get_file_hdr() const { return file_hdr_; }
     int GetFd() { return fd_; }
+    int get_fsm_fd() const { return fsm_.get_fd(); }
+    int get_zone_map_fd() const { return zone_map_.get_fd(); }
 
-    /* 判断指定位置上是否已经存在一条记录，通过Bitmap来判断 */
-    bool is_record(const Rid &rid) const {
-        RmPageHandle page_handle = fetch_page_handle(rid.page_no);
-        return Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
-    }
+    bool is_record(const Rid &rid) const;
 
     std::unique_ptr<RmRecord> get_record(const Rid &rid, Context *context) const;
 
+    RecordView get_record_view(const Rid &rid, Context *context) const;
+
+    void get_record_cols(const Rid &rid, const std::vector<RmVarCol> &cols, char *out) const;
+
     Rid insert_record(char *buf, Context *context);
 
+    void insert_records(const char *buf, int num_records, std::vector<Rid> *rids, Context *context);
+
     void insert_record(const Rid &rid, char *buf);
 
     void delete_record(const Rid &rid, Context *context);
 
     void update_record(const Rid &rid, char *buf, Context *context);
 
-    RmPageHandle create_new_page_handle();
+    RmPageHandle fetch_page_handle(int page_no, BufferAccessStrategy *strategy = nullptr) const;
+
+    void shrink_file();
 
-    RmPageHandle fetch_page_handle(int page_no) const;
+    int vacuum(const std::function<void(const Rid &, const Rid &, const char *)> &on_move);
 
    private:
-    RmPageHandle create_page_handle();
+    bool is_slotted() const { return file_hdr_.format == RM_FORMAT_SLOTTED; }
+
+    bool is_pax() const { return file_hdr_.format == RM_FORMAT_PAX; }
+
+    void read_slot(const RmPageHandle &page_handle, int slot_no, char *out) const;
+
+    void write_slot(RmPageHandle &page_handle, int slot_no, const char *buf) const;
+
+    void erase_slot(WritePageGuard &guard, RmPageHandle &page_handle, int slot_no);
+
+    bool is_page_full(const RmPageHandle &page_handle) const;
+
+    int get_num_pages();
+
+    void update_free_space(RmPageHandle &page_handle, bool was_full);
+
+    void free_page_if_empty(WritePageGuard &guard, RmPageHandle &page_handle, bool was_full);
+
+    int insert_into_page(RmPageHandle &page_handle, const char *buf);
+
+    int encode_record(const char *buf, char *out) const;
+
+    void decode_record(const char *src, int len, char *out) const;
+
+    ReadPageGuard fetch_slotted_record(const Rid &rid, const char **data, int *len) const;
+
+    Rid insert_slotted_record(const char *data, int len, uint16_t flags, int exclude_page_no);
+
+    void insert_slotted_record(const Rid &rid, char *buf);
+
+    void delete_slotted_record(const Rid &rid);
+
+    void update_slotted_record(const Rid &rid, char *buf);
+
+    void erase_slotted_record(WritePageGuard &guard, int slot_no);
+
+    ReadPageGuard fetch_page_read(int page_no) const;
+
+    WritePageGuard fetch_page_write(int page_no);
+
+    WritePageGuard create_new_page();
+
+    WritePageGuard fetch_free_page(int exclude_page_no);
+
+    WritePageGuard fetch_second_page_write(int page_no, int held_page_no);
+
+    bool fetch_forward_page(const Rid &rid, const Rid &target, WritePageGuard &guard, WritePageGuard *target_guard);
+
+    WritePageGuard fetch_free_page_below(int limit_page_no, int exclude_page_no);
 
-    void release_page_handle(RmPageHandle &page_handle);
+    int vacuum_page(int page_no, const std::function<void(const Rid &, const Rid &, const char *)> &on_move,
+                    bool *has_room);
 };
\ No newline at end of file
@@ -0,0 +1,100 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_free_space_map.h"
+
+#include <algorithm>
+
+/**
+ * @description: 判断数据页面是否还有空闲空间，还没有创建映射页面的数据页面视为没有空闲空间
+ * @param {int} page_no 数据页面号
+ */
+bool RmFreeSpaceMap::is_free(int page_no) const {
+    int map_page_no = page_no / BITS_PER_PAGE;
+    if (map_page_no >= num_map_pages_) {
+        return false;
+    }
+    ReadPageGuard guard = buffer_pool_manager_->fetch_page_read(PageId{fd_, map_page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmFreeSpaceMap::is_free Error");
+    }
+    return Bitmap::is_set(guard.get_data() + OFFSET_BITS, page_no % BITS_PER_PAGE);
+}
+
+/**
+ * @description: 设置数据页面是否还有空闲空间，对应的映射页面还不存在时先创建。位没有变化时不把映射页面标记为脏页
+ * @param {int} page_no 数据页面号
+ * @param {bool} is_free 页面是否还有空闲空间
+ */
+void RmFreeSpaceMap::set_free(int page_no, bool is_free) {
+    int map_page_no = page_no / BITS_PER_PAGE;
+    if (map_page_no >= num_map_pages_) {
+        if (!is_free) {
+            return;
+        }
+        grow(map_page_no);
+    }
+    WritePageGuard guard = buffer_pool_manager_->fetch_page_write(PageId{fd_, map_page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmFreeSpaceMap::set_free Error");
+    }
+    int bit = page_no % BITS_PER_PAGE;
+    if (Bitmap::is_set(guard.get_data() + OFFSET_BITS, bit) == is_free) {
+        return;
+    }
+    char *bits = guard.get_data_mut() + OFFSET_BITS;
+    if (is_free) {
+        Bitmap::set(bits, bit);
+    } else {
+        Bitmap::reset(bits, bit);
+    }
+}
+
+/**
+ * @description: 查找一个有空闲空间的数据页面。先从start向后查找，找不到时从文件开头查找，
+ *              不同的插入者从不同的位置开始查找，可以分散到不同的页面上
+ * @param {int} start 开始查找的数据页面号
+ * @param {int} exclude_page_no 不能返回的页面，调用者已经持有它的写锁；没有时为RM_NO_PAGE
+ * @param {int} num_pages 数据文件的页面个数，只返回小于它的页面号
+ * @return {int} 找到的数据页面号，没有时返回RM_NO_PAGE
+ */
+int RmFreeSpaceMap::find_free_page(int start, int exclude_page_no, int num_pages) const {
+    for (int from : {start, RM_FIRST_RECORD_PAGE}) {
+        int page_no = next_free_page(from, num_pages);
+        if (page_no != RM_NO_PAGE && page_no == exclude_page_no) {
+            page_no = next_free_page(page_no + 1, num_pages);
+        }
+        if (page_no != RM_NO_PAGE) {
+            return page_no;
+        }
+    }
+    return RM_NO_PAGE;
+}
+
+/**
+ * @description: 返回不小于from的第一个有空闲空间的数据页面号，没有时返回RM_NO_PAGE
+ */
+int RmFreeSpaceMap::next_free_page(int from, int num_pages) const {
+    from = std::max(from, RM_FIRST_RECORD_PAGE);
+    for (int map_page_no = from / BITS_PER_PAGE;
+         map_page_no < num_map_pages_ && map_page_no * BITS_PER_PAGE < num_pages; map_page_no++) {
+        ReadPageGuard guard = buffer_pool_manager_->fetch_page_read(PageId{fd_, map_page_no});
+        if (!guard.is_valid()) {
+            throw InternalError("RmFreeSpaceMap::next_free_page Error");
+        }
+        int curr = map_page_no == from / BITS_PER_PAGE ? from % BITS_PER_PAGE - 1 : -1;
+        int bit = Bitmap::next_bit(true, guard.get_data() + OFFSET_BITS, BITS_PER_PAGE, curr);
+        if (bit < BITS_PER_PAGE) {
+            int page_no = map_page_no * BITS_PER_PAGE + bit;
+            return page_no < num_pages ? page_no : RM_NO_PAGE;
+        }
+    }
+    return RM_NO_PAGE;
+}
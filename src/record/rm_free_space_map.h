@@ -0,0 +1,40 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "bitmap.h"
+#include "rm_map_file.h"
+
+/**
+ * @description: 表数据文件的空闲空间映射(free space map)，存放在与数据文件同名、后缀为RM_FSM_SUFFIX的文件中。
+ * 每个数据页面对应一位，置位表示页面还能插入一条最长的记录。第k个映射页面记录数据页面
+ * [k * BITS_PER_PAGE, (k + 1) * BITS_PER_PAGE)的状态，映射页面在第一次需要时创建，之后不再释放。
+ * 位的读写持有映射页面的读写锁；修改数据页面对应的位时调用者已经持有该数据页面的写锁，
+ * 加锁顺序总是先数据页面后映射页面
+ */
+class RmFreeSpaceMap : public RmMapFile {
+   public:
+    // 映射页面跳过页头中的LSN，映射不写日志，页面的LSN始终为0
+    static constexpr int OFFSET_BITS = Page::OFFSET_PAGE_HDR;
+    static constexpr int BITS_PER_PAGE = (PAGE_SIZE - OFFSET_BITS) * BITMAP_WIDTH;
+
+    RmFreeSpaceMap(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
+        : RmMapFile(disk_manager, buffer_pool_manager, fd) {}
+
+    bool is_free(int page_no) const;
+
+    void set_free(int page_no, bool is_free);
+
+    int find_free_page(int start, int exclude_page_no, int num_pages) const;
+
+   private:
+    int next_free_page(int from, int num_pages) const;
+};
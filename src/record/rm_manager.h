@@ -12,6 +12,9 @@ See the Mulan PSL v2 for more details. */
 
 #include <assert.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "bitmap.h"
 #include "rm_defs.h"
 #include "rm_file_handle.h"
@@ -30,23 +33,63 @@ class RmManager {
      * @description: 创建表的数据文件并初始化相关信息
      * @param {string&} filename 要创建的文件名称
      * @param {int} record_size 表中记录的大小
+     * @param {RmFileFormat} format 页面格式
+     * @param {vector<RmVarCol>&} cols slotted格式为变长字段在记录中的位置，bitmap格式按最大长度存储，忽略该参数；
+     *                                 PAX格式为所有字段在记录中的位置，每个字段在页面中有一个minipage
+     * @param {vector<RmZoneCol>&} zone_cols 维护页面摘要的候选字段，长度超过RM_MAX_ZONE_COL_LEN的字段被忽略，
+     *                                       最多取前RM_MAX_ZONE_COLS个
      */ 
-    void create_file(const std::string& filename, int record_size) {
+    void create_file(const std::string& filename, int record_size, RmFileFormat format = RM_FORMAT_BITMAP,
+                     const std::vector<RmVarCol>& cols = {}, const std::vector<RmZoneCol>& zone_cols = {}) {
         if (record_size < 1 || record_size > RM_MAX_RECORD_SIZE) {
             throw InvalidRecordSizeError(record_size);
         }
+        if (format == RM_FORMAT_PAX && cols.size() > RM_MAX_PAX_COLS) {
+            throw TooManyColumnsError("PAX", static_cast<int>(cols.size()), RM_MAX_PAX_COLS);
+        }
         disk_manager_->create_file(filename);
+        // 数据文件不存在时遗留的映射文件和摘要文件已经没有意义，重新创建
+        for (auto& side_filename : {get_fsm_file_name(filename), get_zone_map_file_name(filename)}) {
+            if (disk_manager_->is_file(side_filename)) {
+                disk_manager_->destroy_file(side_filename);
+            }
+            disk_manager_->create_file(side_filename);
+        }
         int fd = disk_manager_->open_file(filename);
 
         // 初始化file header
         RmFileHdr file_hdr{};
         file_hdr.record_size = record_size;
         file_hdr.num_pages = 1;
-        file_hdr.first_free_page_no = RM_NO_PAGE;
-        // We have: sizeof(hdr) + (n + 7) / 8 + n * record_size <= PAGE_SIZE
-        file_hdr.num_records_per_page =
-            (BITMAP_WIDTH * (PAGE_SIZE - 1 - (int)sizeof(RmFileHdr)) + 1) / (1 + record_size * BITMAP_WIDTH);
-        file_hdr.bitmap_size = (file_hdr.num_records_per_page + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        file_hdr.format = format;
+        if (format == RM_FORMAT_SLOTTED) {
+            // 槽目录按需增长，num_records_per_page只是槽号的上界
+            file_hdr.num_records_per_page = RmSlottedPage::max_slots();
+            file_hdr.bitmap_size = 0;
+            file_hdr.num_var_cols = static_cast<int>(cols.size());
+            std::copy(cols.begin(), cols.end(), file_hdr.var_cols);
+            std::sort(file_hdr.var_cols, file_hdr.var_cols + file_hdr.num_var_cols,
+                      [](const RmVarCol& a, const RmVarCol& b) { return a.offset < b.offset; });
+        } else {
+            // PAX格式与bitmap格式容量相同：每个字段的minipage存放n个值，所有minipage的总大小为n * record_size
+            // We have: sizeof(hdr) + (n + 7) / 8 + n * record_size <= PAGE_SIZE
+            int hdr_size = Page::OFFSET_PAGE_HDR + sizeof(RmPageHdr);
+            file_hdr.num_records_per_page =
+                (BITMAP_WIDTH * (PAGE_SIZE - 1 - hdr_size) + 1) / (1 + record_size * BITMAP_WIDTH);
+            file_hdr.bitmap_size = (file_hdr.num_records_per_page + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+            if (format == RM_FORMAT_PAX) {
+                file_hdr.num_pax_cols = static_cast<int>(cols.size());
+                std::copy(cols.begin(), cols.end(), file_hdr.pax_cols);
+                std::sort(file_hdr.pax_cols, file_hdr.pax_cols + file_hdr.num_pax_cols,
+                          [](const RmVarCol& a, const RmVarCol& b) { return a.offset < b.offset; });
+            }
+        }
+        for (auto& zone_col : zone_cols) {
+            if (file_hdr.num_zone_cols < RM_MAX_ZONE_COLS && zone_col.len <= RM_MAX_ZONE_COL_LEN) {
+                file_hdr.zone_cols[file_hdr.num_zone_cols++] = zone_col;
+            }
+        }
+        file_hdr.is_clean = 1;
 
         // 将file header写入磁盘文件（名为file name，文件描述符为fd）中的第0页
         // head page直接写入磁盘，没有经过缓冲区的NewPage，那么也就不需要FlushPage
@@ -55,30 +98,80 @@ class RmManager {
     }
 
     /**
-     * @description: 删除表的数据文件
+     * @description: 删除表的数据文件及其空闲空间映射文件和页面摘要文件
      * @param {string&} filename 要删除的文件名称
      */    
-    void destroy_file(const std::string& filename) { disk_manager_->destroy_file(filename); }
+    void destroy_file(const std::string& filename) {
+        disk_manager_->destroy_file(filename);
+        for (auto& side_filename : {get_fsm_file_name(filename), get_zone_map_file_name(filename)}) {
+            if (disk_manager_->is_file(side_filename)) {
+                disk_manager_->destroy_file(side_filename);
+            }
+        }
+    }
 
     // 注意这里打开文件，创建并返回了record file handle的指针
     /**
-     * @description: 打开表的数据文件，并返回文件句柄
+     * @description: 打开表的数据文件，并返回文件句柄。页面摘要不写日志，文件上次没有正常关闭时摘要可能比数据页面中的记录范围窄，
+     *              打开时全部作废；打开后立即把文件头中的正常关闭标记清零写回磁盘，之后的故障同样能被发现
      * @param {string&} filename 要打开的文件名称
      * @return {unique_ptr<RmFileHandle>} 文件句柄的指针
      */
     std::unique_ptr<RmFileHandle> open_file(const std::string& filename) {
-        int fd = disk_manager_->open_file(filename);
-        return std::make_unique<RmFileHandle>(disk_manager_, buffer_pool_manager_, fd);
+        int fd = disk_manager_->open_file(filename, DIRECT_IO);
+        int fsm_fd = disk_manager_->open_file(get_fsm_file_name(filename), DIRECT_IO);
+        int zm_fd = disk_manager_->open_file(get_zone_map_file_name(filename), DIRECT_IO);
+        auto file_handle = std::make_unique<RmFileHandle>(disk_manager_, buffer_pool_manager_, fd, fsm_fd, zm_fd);
+        if (!file_handle->file_hdr_.is_clean) {
+            file_handle->zone_map_.invalidate(file_handle->file_hdr_.num_pages);
+        }
+        file_handle->file_hdr_.is_clean = 0;
+        RmFileHdr file_hdr = file_handle->file_hdr_;
+        disk_manager_->write_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr, sizeof(file_hdr));
+        return file_handle;
     }
     /**
-     * @description: 关闭表的数据文件
+     * @description: 把表的数据文件在缓冲池中的脏页和文件头写回磁盘，文件保持打开
+     * @return {FlushStats} 写回的页面数、字节数和写请求数
+     * @param {RmFileHandle*} file_handle 文件句柄
+     */
+    FlushStats flush_file(const RmFileHandle* file_handle) {
+        FlushStats stats = buffer_pool_manager_->flush_all_pages(file_handle->fd_);
+        stats += buffer_pool_manager_->flush_all_pages(file_handle->get_fsm_fd());
+        stats += buffer_pool_manager_->flush_all_pages(file_handle->get_zone_map_fd());
+        RmFileHdr file_hdr = file_handle->file_hdr_;
+        disk_manager_->write_page(file_handle->fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr, sizeof(file_hdr));
+        return stats;
+    }
+
+    /**
+     * @description: 关闭表的数据文件，所有页面写回磁盘之后才在文件头中设置正常关闭标记
      * @param {RmFileHandle*} file_handle 要关闭文件的句柄
      */
     void close_file(const RmFileHandle* file_handle) {
-        disk_manager_->write_page(file_handle->fd_, RM_FILE_HDR_PAGE, (char *)&file_handle->file_hdr_,
-                                  sizeof(file_handle->file_hdr_));
         // 缓冲区的所有页刷到磁盘，注意这句话必须写在close_file前面
         buffer_pool_manager_->flush_all_pages(file_handle->fd_);
+        buffer_pool_manager_->flush_all_pages(file_handle->get_fsm_fd());
+        buffer_pool_manager_->flush_all_pages(file_handle->get_zone_map_fd());
+        // 离线收缩：截断文件末尾已经释放的页面，文件头中记录收缩后的页面个数
+        RmFileHdr file_hdr = file_handle->file_hdr_;
+        file_hdr.num_pages -= disk_manager_->shrink_file(file_handle->fd_);
+        file_hdr.is_clean = 1;
+        disk_manager_->write_page(file_handle->fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr, sizeof(file_hdr));
         disk_manager_->close_file(file_handle->fd_);
+        disk_manager_->close_file(file_handle->get_fsm_fd());
+        disk_manager_->close_file(file_handle->get_zone_map_fd());
     }
+
+    /**
+     * @description: 表的数据文件对应的空闲空间映射文件名称
+     * @param {string&} filename 数据文件名称
+     */
+    static std::string get_fsm_file_name(const std::string& filename) { return filename + RM_FSM_SUFFIX; }
+
+    /**
+     * @description: 表的数据文件对应的页面摘要文件名称
+     * @param {string&} filename 数据文件名称
+     */
+    static std::string get_zone_map_file_name(const std::string& filename) { return filename + RM_ZONE_MAP_SUFFIX; }
 };
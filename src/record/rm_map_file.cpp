@@ -0,0 +1,37 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_map_file.h"
+
+RmMapFile::RmMapFile(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
+    : buffer_pool_manager_(buffer_pool_manager), fd_(fd) {
+    num_map_pages_ = disk_manager->get_file_size(disk_manager->get_file_name(fd)) / PAGE_SIZE;
+    disk_manager->set_fd2pageno(fd, num_map_pages_);
+}
+
+/**
+ * @description: 保证映射页面map_page_no已经存在，缺少的映射页面依次在文件末尾创建，新页面全部为0
+ * @param {int} map_page_no 映射页面号
+ */
+void RmMapFile::grow(int map_page_no) {
+    if (map_page_no < num_map_pages_) {
+        return;
+    }
+    std::scoped_lock lock{grow_latch_};
+    while (num_map_pages_ <= map_page_no) {
+        PageId page_id{fd_, INVALID_PAGE_ID};
+        Page *page = buffer_pool_manager_->new_page(&page_id);
+        if (page == nullptr) {
+            throw InternalError("RmMapFile::grow Error");
+        }
+        buffer_pool_manager_->unpin_page(page_id, true);
+        num_map_pages_++;
+    }
+}
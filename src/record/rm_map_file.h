@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "rm_defs.h"
+
+/**
+ * @description: 表数据文件的附属映射文件，空闲空间映射和页面摘要共用。
+ * 映射文件由定长的映射页面组成，映射页面在第一次需要时依次创建在文件末尾，之后不再释放
+ */
+class RmMapFile {
+   public:
+    RmMapFile(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd);
+
+    int get_fd() const { return fd_; }
+
+   protected:
+    void grow(int map_page_no);
+
+    BufferPoolManager *buffer_pool_manager_;
+    int fd_;                            // 映射文件的文件句柄
+    std::atomic<int> num_map_pages_;    // 映射文件中已经创建的页面个数
+    std::mutex grow_latch_;             // 创建新的映射页面时加锁
+};
@@ -9,34 +9,80 @@ MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
 See the Mulan PSL v2 for more details. */
 
 #include "rm_scan.h"
+
+#include <algorithm>
+
 #include "rm_file_handle.h"
 
 /**
  * @brief 初始化file_handle和rid
  * @param file_handle
+ * @param preds 扫描条件中能用页面摘要判断的部分，扫描仍然返回这些页面之外的所有记录，由调用者再判断条件
  */
-RmScan::RmScan(const RmFileHandle *file_handle) : file_handle_(file_handle) {
-    // Todo:
+RmScan::RmScan(const RmFileHandle *file_handle, std::vector<RmZonePred> preds)
+    : file_handle_(file_handle), relocation_(file_handle->relocation_latch_), preds_(std::move(preds)) {
+    // 表的页面数超过缓冲池的1/SCAN_RING_THRESHOLD_DIVISOR时，扫描使用私有的帧环
+    BufferPoolManager *bpm = file_handle_->buffer_pool_manager_;
+    if (static_cast<size_t>(file_handle_->file_hdr_.num_pages) > bpm->get_pool_size() / SCAN_RING_THRESHOLD_DIVISOR) {
+        strategy_ = std::make_shared<BufferAccessStrategy>(bpm, SCAN_RING_SIZE);
+    }
     // 初始化file_handle和rid（指向第一个存放了记录的位置）
-
+    rid_ = Rid{RM_FIRST_RECORD_PAGE, -1};
+    prefetched_until_ = RM_FIRST_RECORD_PAGE;
+    next();
 }
 
+RmScan::~RmScan() { release_page(); }
+
 /**
  * @brief 找到文件中下一个存放了记录的位置
  */
 void RmScan::next() {
-    // Todo:
     // 找到文件中下一个存放了记录的非空闲位置，用rid_来指向这个位置
-
+    while (rid_.page_no != RM_NO_PAGE && rid_.page_no < file_handle_->file_hdr_.num_pages) {
+        if (page_ == nullptr) {
+            // 页面摘要表明页面中没有满足条件的记录时不读取该页面
+            if (!may_match(rid_.page_no)) {
+                rid_ = Rid{rid_.page_no + 1, -1};
+                continue;
+            }
+            prefetch();
+            page_ = file_handle_->fetch_page_handle(rid_.page_no, strategy_.get()).page;
+        }
+        // 插入、删除和页面整理在写锁下修改bitmap或槽目录，查找下一个slot时持有页面的读锁
+        RmPageHandle page_handle(&file_handle_->file_hdr_, page_);
+        bool found;
+        page_->RLatch();
+        if (file_handle_->is_slotted()) {
+            // slotted格式跳过空槽和从其他页面移入的记录，被移走的记录在原位置上返回
+            RmSlottedPage page = page_handle.slotted();
+            int num_slots = page.num_slots();
+            do {
+                rid_.slot_no++;
+            } while (rid_.slot_no < num_slots &&
+                     (!page.is_used(rid_.slot_no) || (page.get_flags(rid_.slot_no) & RM_SLOT_MOVED)));
+            found = rid_.slot_no < num_slots;
+        } else {
+            rid_.slot_no = Bitmap::next_bit(true, page_handle.bitmap, file_handle_->file_hdr_.num_records_per_page,
+                                            rid_.slot_no);
+            found = rid_.slot_no < file_handle_->file_hdr_.num_records_per_page;
+        }
+        page_->RUnlatch();
+        if (found) {
+            return;
+        }
+        release_page();
+        rid_ = Rid{rid_.page_no + 1, -1};
+    }
+    release_page();
+    rid_ = Rid{RM_NO_PAGE, -1};
 }
 
 /**
  * @brief ​ 判断是否到达文件末尾
  */
 bool RmScan::is_end() const {
-    // Todo: 修改返回值
-
-    return false;
+    return rid_.page_no == RM_NO_PAGE;
 }
 
 /**
@@ -44,4 +90,46 @@ bool RmScan::is_end() const {
  */
 Rid RmScan::rid() const {
     return rid_;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 预读当前页面之后的PREFETCH_DISTANCE个页面。已提交预读的页面不足一半时才提交下一批，减少任务数。
+ *        跳过页面摘要表明不满足条件的页面，连续的页面合并为一次预读
+ */
+void RmScan::prefetch() {
+    int num_pages = file_handle_->file_hdr_.num_pages;
+    int target = std::min(rid_.page_no + 1 + PREFETCH_DISTANCE, num_pages);
+    int first = std::max(prefetched_until_, rid_.page_no + 1);
+    if (target <= first || prefetched_until_ - rid_.page_no > PREFETCH_DISTANCE / 2) {
+        return;
+    }
+    int run_start = first;
+    for (int page_no = first; page_no <= target; page_no++) {
+        if (page_no < target && may_match(page_no)) {
+            continue;
+        }
+        if (page_no > run_start) {
+            file_handle_->buffer_pool_manager_->prefetch_pages(file_handle_->fd_, run_start, page_no - run_start,
+                                                               strategy_);
+        }
+        run_start = page_no + 1;
+    }
+    prefetched_until_ = target;
+}
+
+/**
+ * @brief 根据页面摘要判断页面中是否可能有满足扫描条件的记录
+ */
+bool RmScan::may_match(int page_no) const {
+    return preds_.empty() || file_handle_->zone_map_.may_match(page_no, preds_);
+}
+
+/**
+ * @brief 取消固定当前扫描的页面
+ */
+void RmScan::release_page() {
+    if (page_ != nullptr) {
+        file_handle_->buffer_pool_manager_->unpin_page(page_->get_page_id(), false);
+        page_ = nullptr;
+    }
+}
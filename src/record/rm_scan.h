@@ -10,19 +10,42 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
 #include "rm_defs.h"
+#include "rm_zone_map.h"
 
 class RmFileHandle;
+class RmRelocationLatch;
 
 class RmScan : public RecScan {
     const RmFileHandle *file_handle_;
+    std::shared_lock<RmRelocationLatch> relocation_;  // 扫描期间VACUUM不移动记录，避免记录被移到已经扫描过的页面
     Rid rid_;
+    Page *page_ = nullptr;      // 当前扫描到的页面，扫描期间保持固定，离开该页面时unpin
+    std::shared_ptr<BufferAccessStrategy> strategy_;   // 表大于阈值时使用私有的帧环，避免冲刷缓冲池，预读任务也会持有它
+    int prefetched_until_;      // [rid_.page_no, prefetched_until_)范围内的页面已经提交过预读
+    std::vector<RmZonePred> preds_;  // 扫描条件中能用页面摘要判断的部分，页面摘要表明不满足的页面不读取
 public:
-    RmScan(const RmFileHandle *file_handle);
+    RmScan(const RmFileHandle *file_handle, std::vector<RmZonePred> preds = {});
+
+    ~RmScan() override;
+
+    RmScan(const RmScan &) = delete;
+    RmScan &operator=(const RmScan &) = delete;
 
     void next() override;
 
     bool is_end() const override;
 
     Rid rid() const override;
+
+private:
+    void release_page();
+
+    void prefetch();
+
+    bool may_match(int page_no) const;
 };
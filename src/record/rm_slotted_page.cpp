@@ -0,0 +1,156 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_slotted_page.h"
+
+#include <algorithm>
+#include <cassert>
+
+static_assert(PAGE_SIZE <= RM_SLOT_LEN_MASK, "slot offset and length must fit in RmSlot");
+
+/**
+ * @description: 初始化一个空的slotted页面，不修改空闲空间映射
+ */
+void RmSlottedPage::init() {
+    page_hdr_->num_records = 0;
+    page_hdr_->first_free_slot = 0;
+    hdr_->num_slots = 0;
+    hdr_->data_begin = PAGE_SIZE;
+    hdr_->live_bytes = 0;
+    hdr_->reserved = 0;
+}
+
+/**
+ * @description: 在页面中找一个空槽插入一条记录，没有空槽时在槽目录末尾新增一个槽
+ * @param {char*} src 记录数据
+ * @param {int} len 记录长度
+ * @param {uint16_t} flags 槽的标志位
+ * @return {int} 插入的槽号，页面空间不够时返回-1
+ */
+int RmSlottedPage::insert(const char *src, int len, uint16_t flags) {
+    int slot_no = page_hdr_->first_free_slot;
+    while (slot_no < hdr_->num_slots && slots_[slot_no].offset != 0) {
+        slot_no++;
+    }
+    int extra_dir_bytes = slot_no == hdr_->num_slots ? sizeof(RmSlot) : 0;
+    int offset = allocate(alloc_size(len), extra_dir_bytes);
+    if (offset == 0) {
+        return -1;
+    }
+    if (extra_dir_bytes != 0) {
+        hdr_->num_slots++;
+    }
+    slots_[slot_no] = RmSlot{static_cast<uint16_t>(offset), static_cast<uint16_t>(len | flags)};
+    memcpy(data_ + offset, src, len);
+    page_hdr_->num_records++;
+    page_hdr_->first_free_slot = slot_no + 1;
+    return slot_no;
+}
+
+/**
+ * @description: 在指定的空槽中插入一条记录，槽号超出槽目录时扩展槽目录，用于回滚删除和故障恢复
+ * @return {bool} 页面空间不够时返回false，页面不变
+ */
+bool RmSlottedPage::insert_at(int slot_no, const char *src, int len, uint16_t flags) {
+    assert(!is_used(slot_no));
+    int num_slots = hdr_->num_slots;
+    int extra_dir_bytes = slot_no >= num_slots ? (slot_no + 1 - num_slots) * static_cast<int>(sizeof(RmSlot)) : 0;
+    int offset = allocate(alloc_size(len), extra_dir_bytes);
+    if (offset == 0) {
+        return false;
+    }
+    for (int i = num_slots; i < slot_no; i++) {
+        slots_[i] = RmSlot{0, 0};
+    }
+    hdr_->num_slots = std::max(num_slots, slot_no + 1);
+    slots_[slot_no] = RmSlot{static_cast<uint16_t>(offset), static_cast<uint16_t>(len | flags)};
+    memcpy(data_ + offset, src, len);
+    page_hdr_->num_records++;
+    return true;
+}
+
+/**
+ * @description: 用新数据替换槽中的记录，新记录不比旧记录长时原地更新，否则释放旧记录后重新分配
+ * @return {bool} 页面放不下新记录时返回false，原记录不变
+ */
+bool RmSlottedPage::update(int slot_no, const char *src, int len, uint16_t flags) {
+    int old_alloc = alloc_size(get_len(slot_no));
+    int new_alloc = alloc_size(len);
+    if (new_alloc <= old_alloc) {
+        // 原地更新，旧记录多出的部分成为碎片
+        memcpy(data_ + slots_[slot_no].offset, src, len);
+        slots_[slot_no].len = static_cast<uint16_t>(len | flags);
+        hdr_->live_bytes -= old_alloc - new_alloc;
+        return true;
+    }
+    if (free_space() + old_alloc < new_alloc) {
+        return false;
+    }
+    slots_[slot_no].offset = 0;
+    hdr_->live_bytes -= old_alloc;
+    int offset = allocate(new_alloc, 0);
+    assert(offset != 0);
+    slots_[slot_no] = RmSlot{static_cast<uint16_t>(offset), static_cast<uint16_t>(len | flags)};
+    memcpy(data_ + offset, src, len);
+    return true;
+}
+
+/**
+ * @description: 删除槽中的记录，槽变为空槽，槽目录末尾的空槽被回收
+ */
+void RmSlottedPage::erase(int slot_no) {
+    assert(is_used(slot_no));
+    hdr_->live_bytes -= alloc_size(get_len(slot_no));
+    slots_[slot_no] = RmSlot{0, 0};
+    page_hdr_->num_records--;
+    page_hdr_->first_free_slot = std::min(page_hdr_->first_free_slot, slot_no);
+    while (hdr_->num_slots > 0 && slots_[hdr_->num_slots - 1].offset == 0) {
+        hdr_->num_slots--;
+    }
+    if (hdr_->num_slots == 0) {
+        hdr_->data_begin = PAGE_SIZE;
+    }
+}
+
+/**
+ * @description: 整理页面，把所有记录紧凑地移到页尾，回收记录区中的碎片。槽号不变
+ */
+void RmSlottedPage::compact() {
+    char tmp[PAGE_SIZE];
+    memcpy(tmp + hdr_->data_begin, data_ + hdr_->data_begin, PAGE_SIZE - hdr_->data_begin);
+    int end = PAGE_SIZE;
+    for (int i = 0; i < hdr_->num_slots; i++) {
+        if (slots_[i].offset == 0) {
+            continue;
+        }
+        int alloc = alloc_size(get_len(i));
+        end -= alloc;
+        memcpy(data_ + end, tmp + slots_[i].offset, alloc);
+        slots_[i].offset = static_cast<uint16_t>(end);
+    }
+    hdr_->data_begin = static_cast<uint16_t>(end);
+}
+
+/**
+ * @description: 在记录区中分配alloc字节，同时为槽目录预留extra_dir_bytes字节，连续空闲空间不够时先整理页面
+ * @return {int} 分配到的偏移，页面空间不够时返回0
+ */
+int RmSlottedPage::allocate(int alloc, int extra_dir_bytes) {
+    if (free_space() < alloc + extra_dir_bytes) {
+        return 0;
+    }
+    int dir_end = HDR_END + hdr_->num_slots * static_cast<int>(sizeof(RmSlot)) + extra_dir_bytes;
+    if (hdr_->data_begin - dir_end < alloc) {
+        compact();
+    }
+    hdr_->data_begin -= alloc;
+    hdr_->live_bytes += alloc;
+    return hdr_->data_begin;
+}
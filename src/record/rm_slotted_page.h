@@ -0,0 +1,98 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstdint>
+
+#include "rm_defs.h"
+
+/* slotted格式页面的页内元信息，紧跟在RmPageHdr之后 */
+struct RmSlottedHdr {
+    uint16_t num_slots;   // 槽目录中槽的个数，包括已经删除的空槽
+    uint16_t data_begin;  // 记录区的起始偏移，记录从页尾向前存放，[data_begin, PAGE_SIZE)为记录区
+    uint16_t live_bytes;  // 记录区中仍在使用的字节数，其余为删除和更新留下的碎片，整理页面时回收
+    uint16_t reserved;
+};
+
+/* 槽目录中的一项，槽目录紧跟在RmSlottedHdr之后，槽号就是Rid中的slot_no */
+struct RmSlot {
+    uint16_t offset;  // 记录在页面中的偏移，0表示空槽
+    uint16_t len;     // 记录的长度，最高两位为标志位
+};
+
+constexpr uint16_t RM_SLOT_FORWARD = 0x8000;    // 记录被移到了其他页面，槽中只存放记录新位置的Rid
+constexpr uint16_t RM_SLOT_MOVED = 0x4000;      // 记录从其他页面移入，前sizeof(Rid)字节是记录原位置的Rid，扫描时跳过
+constexpr uint16_t RM_SLOT_LEN_MASK = 0x3fff;
+constexpr int RM_SLOTTED_MIN_TUPLE = sizeof(Rid);  // 每条记录至少占用的字节数，保证记录移走后原位置放得下转发的Rid
+// 一条记录编码后的最大长度：定长记录、每个变长字段的长度前缀，以及移入其他页面时记录原位置的Rid
+constexpr int RM_MAX_SLOTTED_TUPLE = RM_MAX_RECORD_SIZE + RM_MAX_VAR_COLS * sizeof(uint16_t) + sizeof(Rid);
+
+/**
+ * @description: slotted格式页面的访问接口。页面由页头、槽目录和记录区组成，槽目录从页头之后向后增长，
+ * 记录区从页尾向前增长，两者之间是连续的空闲空间。删除和变长的更新会在记录区中留下碎片，
+ * 连续空闲空间不够而总空闲空间足够时整理页面。整理只移动记录，不改变槽号，因此Rid保持不变。
+ * 该类只操作页面数据，不负责加锁和空闲空间映射，由RmFileHandle在持有页面写锁时调用
+ */
+class RmSlottedPage {
+   public:
+    static constexpr int HDR_END = Page::OFFSET_PAGE_HDR + sizeof(RmPageHdr) + sizeof(RmSlottedHdr);
+
+    explicit RmSlottedPage(char *data)
+        : data_(data),
+          page_hdr_(reinterpret_cast<RmPageHdr *>(data + Page::OFFSET_PAGE_HDR)),
+          hdr_(reinterpret_cast<RmSlottedHdr *>(data + Page::OFFSET_PAGE_HDR + sizeof(RmPageHdr))),
+          slots_(reinterpret_cast<RmSlot *>(data + HDR_END)) {}
+
+    // 每个页面最多能有的槽个数，每条记录至少占用一个槽和RM_SLOTTED_MIN_TUPLE字节
+    static int max_slots() { return (PAGE_SIZE - HDR_END) / (sizeof(RmSlot) + RM_SLOTTED_MIN_TUPLE); }
+
+    // 长度为len的记录在记录区中实际占用的字节数
+    static int alloc_size(int len) { return len < RM_SLOTTED_MIN_TUPLE ? RM_SLOTTED_MIN_TUPLE : len; }
+
+    void init();
+
+    int num_slots() const { return hdr_->num_slots; }
+
+    // 槽中是否存放了记录，包括转发的Rid和从其他页面移入的记录
+    bool is_used(int slot_no) const { return slot_no >= 0 && slot_no < hdr_->num_slots && slots_[slot_no].offset != 0; }
+
+    uint16_t get_flags(int slot_no) const { return slots_[slot_no].len & ~RM_SLOT_LEN_MASK; }
+
+    int get_len(int slot_no) const { return slots_[slot_no].len & RM_SLOT_LEN_MASK; }
+
+    const char *get_data(int slot_no) const { return data_ + slots_[slot_no].offset; }
+
+    // 页面整理后能够用于存放记录和新槽的字节数
+    int free_space() const {
+        return PAGE_SIZE - HDR_END - hdr_->num_slots * static_cast<int>(sizeof(RmSlot)) - hdr_->live_bytes;
+    }
+
+    // 是否一定能插入一条长度为len的记录（可能需要新增一个槽）
+    bool has_room(int len) const { return free_space() >= alloc_size(len) + static_cast<int>(sizeof(RmSlot)); }
+
+    int insert(const char *src, int len, uint16_t flags);
+
+    bool insert_at(int slot_no, const char *src, int len, uint16_t flags);
+
+    bool update(int slot_no, const char *src, int len, uint16_t flags);
+
+    void erase(int slot_no);
+
+    void compact();
+
+   private:
+    int allocate(int alloc, int extra_dir_bytes);
+
+    char *data_;
+    RmPageHdr *page_hdr_;
+    RmSlottedHdr *hdr_;
+    RmSlot *slots_;
+};
@@ -0,0 +1,203 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_zone_map.h"
+
+/**
+ * @description: 用一条插入或更新到数据页面中的记录扩大页面的摘要，对应的摘要页面还不存在时先创建。
+ *              在记录写入页面之前调用，并发的扫描看到的摘要总是覆盖页面中的记录。摘要没有变化时不把摘要页面标记为脏页，
+ *              已经作废的摘要保持作废
+ * @param {int} page_no 数据页面号
+ * @param {char*} record 定长记录
+ */
+void RmZoneMap::update(int page_no, const char *record) {
+    if (file_hdr_->num_zone_cols == 0) {
+        return;
+    }
+    int map_page_no = page_no / entries_per_page();
+    grow(map_page_no);
+    WritePageGuard guard = buffer_pool_manager_->fetch_page_write(PageId{fd_, map_page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmZoneMap::update Error");
+    }
+    int entry_offset = Page::OFFSET_PAGE_HDR + page_no % entries_per_page() * entry_size();
+    const char *entry = guard.get_data() + entry_offset;
+    int state;
+    memcpy(&state, entry, sizeof(state));
+    if (state == ZONE_INVALID) {
+        return;
+    }
+    if (state != ZONE_VALID) {
+        char *out = guard.get_data_mut() + entry_offset;
+        state = ZONE_VALID;
+        memcpy(out, &state, sizeof(state));
+        int pos = sizeof(state);
+        for (int i = 0; i < file_hdr_->num_zone_cols; i++) {
+            const RmZoneCol &col = file_hdr_->zone_cols[i];
+            memcpy(out + pos, record + col.offset, col.len);
+            memcpy(out + pos + col.len, record + col.offset, col.len);
+            pos += 2 * col.len;
+        }
+        return;
+    }
+    int pos = sizeof(state);
+    for (int i = 0; i < file_hdr_->num_zone_cols; i++) {
+        const RmZoneCol &col = file_hdr_->zone_cols[i];
+        const char *value = record + col.offset;
+        if (compare(i, value, entry + pos) < 0) {
+            memcpy(guard.get_data_mut() + entry_offset + pos, value, col.len);
+        } else if (compare(i, value, entry + pos + col.len) > 0) {
+            memcpy(guard.get_data_mut() + entry_offset + pos + col.len, value, col.len);
+        }
+        pos += 2 * col.len;
+    }
+}
+
+/**
+ * @description: 清空数据页面的摘要，页面被释放或重新分配时调用
+ * @param {int} page_no 数据页面号
+ */
+void RmZoneMap::reset(int page_no) {
+    if (file_hdr_->num_zone_cols == 0) {
+        return;
+    }
+    int map_page_no = page_no / entries_per_page();
+    if (map_page_no >= num_map_pages_) {
+        return;
+    }
+    WritePageGuard guard = buffer_pool_manager_->fetch_page_write(PageId{fd_, map_page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmZoneMap::reset Error");
+    }
+    int entry_offset = Page::OFFSET_PAGE_HDR + page_no % entries_per_page() * entry_size();
+    int state;
+    memcpy(&state, guard.get_data() + entry_offset, sizeof(state));
+    if (state != ZONE_EMPTY) {
+        state = ZONE_EMPTY;
+        memcpy(guard.get_data_mut() + entry_offset, &state, sizeof(state));
+    }
+}
+
+/**
+ * @description: 作废所有数据页面的摘要，文件上次没有正常关闭时打开文件调用。故障前摘要页面可能没有与数据页面一起写回，
+ *              还没有创建摘要页面的数据页面也可能已经有记录，因此覆盖到最后一个数据页面的摘要页面都先创建出来再作废
+ * @param {int} num_pages 数据文件的页面个数
+ */
+void RmZoneMap::invalidate(int num_pages) {
+    if (file_hdr_->num_zone_cols == 0 || num_pages <= 0) {
+        return;
+    }
+    grow((num_pages - 1) / entries_per_page());
+    int state = ZONE_INVALID;
+    for (int map_page_no = 0; map_page_no < num_map_pages_; map_page_no++) {
+        WritePageGuard guard = buffer_pool_manager_->fetch_page_write(PageId{fd_, map_page_no});
+        if (!guard.is_valid()) {
+            throw InternalError("RmZoneMap::invalidate Error");
+        }
+        char *data = guard.get_data_mut();
+        for (int i = 0; i < entries_per_page(); i++) {
+            memcpy(data + Page::OFFSET_PAGE_HDR + i * entry_size(), &state, sizeof(state));
+        }
+    }
+}
+
+/**
+ * @description: 根据摘要判断数据页面中是否可能有满足所有条件的记录。没有摘要的页面总是可能满足
+ * @param {int} page_no 数据页面号
+ * @param {vector<RmZonePred>&} preds 扫描条件，条件之间是AND关系
+ * @return {bool} 返回false时页面中一定没有满足条件的记录，扫描可以跳过该页面
+ */
+bool RmZoneMap::may_match(int page_no, const std::vector<RmZonePred> &preds) const {
+    if (preds.empty() || file_hdr_->num_zone_cols == 0) {
+        return true;
+    }
+    int map_page_no = page_no / entries_per_page();
+    if (map_page_no >= num_map_pages_) {
+        return true;
+    }
+    ReadPageGuard guard = buffer_pool_manager_->fetch_page_read(PageId{fd_, map_page_no});
+    if (!guard.is_valid()) {
+        throw InternalError("RmZoneMap::may_match Error");
+    }
+    const char *entry = guard.get_data() + Page::OFFSET_PAGE_HDR + page_no % entries_per_page() * entry_size();
+    int state;
+    memcpy(&state, entry, sizeof(state));
+    if (state != ZONE_VALID) {
+        return true;
+    }
+    for (auto &pred : preds) {
+        int pos = sizeof(state);
+        for (int i = 0; i < pred.col; i++) {
+            pos += 2 * file_hdr_->zone_cols[i].len;
+        }
+        // 页面中的值都在[min, max]中，据此判断是否可能有值满足 值 op 常量
+        int cmp_min = compare(pred.col, entry + pos, pred.value);
+        int cmp_max = compare(pred.col, entry + pos + file_hdr_->zone_cols[pred.col].len, pred.value);
+        bool possible = true;
+        switch (pred.op) {
+            case OP_EQ:
+                possible = cmp_min <= 0 && cmp_max >= 0;
+                break;
+            case OP_NE:
+                possible = cmp_min != 0 || cmp_max != 0;
+                break;
+            case OP_LT:
+                possible = cmp_min < 0;
+                break;
+            case OP_LE:
+                possible = cmp_min <= 0;
+                break;
+            case OP_GT:
+                possible = cmp_max > 0;
+                break;
+            case OP_GE:
+                possible = cmp_max >= 0;
+                break;
+        }
+        if (!possible) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @description: 每个数据页面的摘要项的大小：状态 + 每个摘要字段的最小值和最大值
+ */
+int RmZoneMap::entry_size() const {
+    int size = sizeof(int);
+    for (int i = 0; i < file_hdr_->num_zone_cols; i++) {
+        size += 2 * file_hdr_->zone_cols[i].len;
+    }
+    return size;
+}
+
+/**
+ * @description: 按摘要字段的类型比较两个值，与索引的比较规则相同
+ */
+int RmZoneMap::compare(int col, const char *a, const char *b) const {
+    const RmZoneCol &zone_col = file_hdr_->zone_cols[col];
+    switch (zone_col.type) {
+        case TYPE_INT: {
+            int ia, ib;
+            memcpy(&ia, a, sizeof(int));
+            memcpy(&ib, b, sizeof(int));
+            return (ia < ib) ? -1 : ((ia > ib) ? 1 : 0);
+        }
+        case TYPE_FLOAT: {
+            float fa, fb;
+            memcpy(&fa, a, sizeof(float));
+            memcpy(&fb, b, sizeof(float));
+            return (fa < fb) ? -1 : ((fa > fb) ? 1 : 0);
+        }
+        default:
+            return memcmp(a, b, zone_col.len);
+    }
+}
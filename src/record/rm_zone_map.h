@@ -0,0 +1,57 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <vector>
+
+#include "common/common.h"
+#include "rm_map_file.h"
+
+/* 扫描条件中可以用页面摘要判断的部分：摘要字段 op 常量 */
+struct RmZonePred {
+    int col;            // 字段在file_hdr.zone_cols中的下标
+    CompOp op;          // 比较运算符
+    const char *value;  // 常量，长度与字段相同，由调用者保证在扫描期间有效
+};
+
+/**
+ * @description: 表数据文件的页面摘要(zone map)，存放在与数据文件同名、后缀为RM_ZONE_MAP_SUFFIX的文件中。
+ * 每个数据页面对应一个定长的项：int状态 + 每个摘要字段的最小值和最大值，状态为0时没有摘要，页面可能包含任意记录。
+ * 摘要只在插入和更新时扩大，删除记录不收缩，页面释放时清空，因此总是覆盖页面中所有的记录。
+ * 摘要不写日志，文件没有正常关闭时所有项被作废，作废的页面总是可能满足条件，直到页面被释放或重新分配
+ * 修改某个数据页面的项时调用者已经持有该数据页面的写锁，加锁顺序总是先数据页面后摘要页面
+ */
+class RmZoneMap : public RmMapFile {
+   public:
+    RmZoneMap(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd, const RmFileHdr *file_hdr)
+        : RmMapFile(disk_manager, buffer_pool_manager, fd), file_hdr_(file_hdr) {}
+
+    void update(int page_no, const char *record);
+
+    void reset(int page_no);
+
+    bool may_match(int page_no, const std::vector<RmZonePred> &preds) const;
+
+    void invalidate(int num_pages);
+
+   private:
+    static constexpr int ZONE_EMPTY = 0;
+    static constexpr int ZONE_VALID = 1;
+    static constexpr int ZONE_INVALID = 2;  // 摘要可能落后于页面中的记录，不能用来跳过页面，也不再扩大
+
+    int entry_size() const;
+
+    int entries_per_page() const { return (PAGE_SIZE - Page::OFFSET_PAGE_HDR) / entry_size(); }
+
+    int compare(int col, const char *a, const char *b) const;
+
+    const RmFileHdr *file_hdr_;         // 数据文件的文件头，摘要字段由它描述
+};
@@ -17,12 +17,26 @@ See the Mulan PSL v2 for more details. */
  * @return {lsn_t} 返回该日志的日志记录号
  */
 lsn_t LogManager::add_log_to_buffer(LogRecord* log_record) {
-  
+    std::scoped_lock lock{latch_};
+    if (log_buffer_.is_full(log_record->log_tot_len_)) {
+        disk_manager_->write_log(log_buffer_.buffer_, log_buffer_.offset_);
+        log_buffer_.offset_ = 0;
+        persist_lsn_ = global_lsn_.load();
+    }
+    log_record->lsn_ = ++global_lsn_;
+    log_record->serialize(log_buffer_.buffer_ + log_buffer_.offset_);
+    log_buffer_.offset_ += log_record->log_tot_len_;
+    return log_record->lsn_;
 }
 
 /**
  * @description: 把日志缓冲区的内容刷到磁盘中，由于目前只设置了一个缓冲区，因此需要阻塞其他日志操作
  */
 void LogManager::flush_log_to_disk() {
-
+    std::scoped_lock lock{latch_};
+    if (log_buffer_.offset_ > 0) {
+        disk_manager_->write_log(log_buffer_.buffer_, log_buffer_.offset_);
+        log_buffer_.offset_ = 0;
+    }
+    persist_lsn_ = global_lsn_.load();
 }
@@ -0,0 +1,129 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "clock_replacer.h"
+
+ClockReplacer::ClockReplacer(size_t num_pages)
+    : in_replacer_(num_pages, false), ref_bit_(num_pages, false), hand_(0), size_(0), max_size_(num_pages) {}
+
+ClockReplacer::~ClockReplacer() = default;
+
+/**
+ * @description: 使用CLOCK策略删除一个victim frame，并返回该frame的id
+ * 时钟指针循环扫描，访问位为1的frame将访问位清零并跳过，遇到第一个访问位为0的frame将其淘汰
+ * @param {frame_id_t*} frame_id 被移除的frame的id，如果没有frame被移除返回nullptr
+ * @return {bool} 如果成功淘汰了一个页面则返回true，否则返回false
+ */
+bool ClockReplacer::victim(frame_id_t* frame_id) {
+    std::scoped_lock lock{latch_};
+    if (size_ == 0) {
+        return false;
+    }
+    // 最多扫描两圈：第一圈清除访问位，第二圈一定能找到访问位为0的frame
+    while (true) {
+        size_t cur = hand_;
+        hand_ = (hand_ + 1) % max_size_;
+        if (!in_replacer_[cur]) {
+            continue;
+        }
+        if (ref_bit_[cur]) {
+            ref_bit_[cur] = false;
+            continue;
+        }
+        in_replacer_[cur] = false;
+        size_--;
+        *frame_id = static_cast<frame_id_t>(cur);
+        return true;
+    }
+}
+
+/**
+ * @description: 固定指定的frame，即该页面无法被淘汰
+ * @param {frame_id_t} 需要固定的frame的id
+ */
+void ClockReplacer::pin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_ || !in_replacer_[frame_id]) {
+        return;
+    }
+    in_replacer_[frame_id] = false;
+    size_--;
+}
+
+/**
+ * @description: 取消固定一个frame，代表该页面可以被淘汰，同时设置其访问位
+ * @param {frame_id_t} frame_id 取消固定的frame的id
+ */
+void ClockReplacer::unpin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_) {
+        return;
+    }
+    ref_bit_[frame_id] = true;
+    if (!in_replacer_[frame_id]) {
+        in_replacer_[frame_id] = true;
+        size_++;
+    }
+}
+
+/**
+ * @description: 记录在replacer之外统计的访问，设置frame的访问位
+ * @param {frame_id_t} frame_id 被访问的frame的id
+ * @param {size_t} count 访问次数
+ */
+void ClockReplacer::record_access(frame_id_t frame_id, size_t count) {
+    std::scoped_lock lock{latch_};
+    if (count == 0 || frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_) {
+        return;
+    }
+    ref_bit_[frame_id] = true;
+}
+
+/**
+ * @description: 按照淘汰顺序列出接下来会被淘汰的frame，不改变replacer的状态。
+ * 模拟时钟指针的扫描：访问位为0的frame在第一圈被淘汰，访问位为1的frame在第二圈被淘汰
+ * @param {size_t} max_count 最多列出的frame个数
+ * @return {vector<frame_id_t>} 第一个元素为下一个victim
+ */
+std::vector<frame_id_t> ClockReplacer::eviction_candidates(size_t max_count) {
+    std::scoped_lock lock{latch_};
+    std::vector<frame_id_t> frame_ids;
+    for (int round = 0; round < 2; round++) {
+        for (size_t i = 0; i < max_size_ && frame_ids.size() < max_count; i++) {
+            size_t cur = (hand_ + i) % max_size_;
+            if (in_replacer_[cur] && ref_bit_[cur] == (round == 1)) {
+                frame_ids.push_back(static_cast<frame_id_t>(cur));
+            }
+        }
+    }
+    return frame_ids;
+}
+
+/**
+ * @description: 扩大replacer的容量，新的frame不在时钟中、引用位为0，时钟指针不变，容量不会缩小
+ * @param {size_t} num_pages 新的容量
+ */
+void ClockReplacer::resize(size_t num_pages) {
+    std::scoped_lock lock{latch_};
+    if (num_pages <= max_size_) {
+        return;
+    }
+    in_replacer_.resize(num_pages, false);
+    ref_bit_.resize(num_pages, false);
+    max_size_ = num_pages;
+}
+
+/**
+ * @description: 获取当前replacer中可以被淘汰的页面数量
+ */
+size_t ClockReplacer::Size() {
+    std::scoped_lock lock{latch_};
+    return size_;
+}
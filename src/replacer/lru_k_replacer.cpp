@@ -0,0 +1,253 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "lru_k_replacer.h"
+
+#include <algorithm>
+#include <queue>
+
+LRUKReplacer::LRUKReplacer(size_t num_pages, size_t k)
+    : k_(k == 0 ? 1 : k),
+      history_(num_pages * (k == 0 ? 1 : k), 0),
+      access_cnt_(num_pages, 0),
+      heap_pos_(num_pages, -1),
+      current_ts_(0),
+      max_size_(num_pages) {
+    inf_heap_.reserve(num_pages);
+    kdist_heap_.reserve(num_pages);
+}
+
+LRUKReplacer::~LRUKReplacer() = default;
+
+/**
+ * @description: 使用LRU-K策略删除一个victim frame，并返回该frame的id，同时清空该frame的访问历史
+ * @param {frame_id_t*} frame_id 被移除的frame的id，如果没有frame被移除返回nullptr
+ * @return {bool} 如果成功淘汰了一个页面则返回true，否则返回false
+ */
+bool LRUKReplacer::victim(frame_id_t* frame_id) {
+    std::scoped_lock lock{latch_};
+    // 访问不足k次的frame优先淘汰，其中第一次访问最早的最先淘汰；
+    // 否则淘汰倒数第k次访问最早(即k-distance最大)的frame
+    std::vector<frame_id_t> &heap = inf_heap_.empty() ? kdist_heap_ : inf_heap_;
+    if (heap.empty()) {
+        return false;
+    }
+    frame_id_t best = heap.front();
+    heap_erase(heap, best);
+    access_cnt_[best] = 0;
+    *frame_id = best;
+    return true;
+}
+
+/**
+ * @description: 固定指定的frame，即该页面无法被淘汰，并记录一次对该frame的访问
+ * @param {frame_id_t} 需要固定的frame的id
+ */
+void LRUKReplacer::pin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_) {
+        return;
+    }
+    // 先按访问前的次数从所在的堆中删除，访问次数达到k时frame会换到另一个堆
+    if (heap_pos_[frame_id] >= 0) {
+        heap_erase(heap_of(frame_id), frame_id);
+    }
+    history_[frame_id * k_ + access_cnt_[frame_id] % k_] = ++current_ts_;
+    access_cnt_[frame_id]++;
+}
+
+/**
+ * @description: 取消固定一个frame，代表该页面可以被淘汰
+ * @param {frame_id_t} frame_id 取消固定的frame的id
+ */
+void LRUKReplacer::unpin(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_ || heap_pos_[frame_id] >= 0) {
+        return;
+    }
+    // 从未被pin过的frame在unpin时也记录一次访问，保证其有访问时间
+    if (access_cnt_[frame_id] == 0) {
+        history_[frame_id * k_] = ++current_ts_;
+        access_cnt_[frame_id] = 1;
+    }
+    heap_push(heap_of(frame_id), frame_id);
+}
+
+/**
+ * @description: 记录在replacer之外统计的访问，不改变frame是否可以被淘汰。
+ *              这些访问按记录时的时间计入历史，超过k次的部分不影响k-distance，最多记录k次
+ * @param {frame_id_t} frame_id 被访问的frame的id
+ * @param {size_t} count 访问次数
+ */
+void LRUKReplacer::record_access(frame_id_t frame_id, size_t count) {
+    std::scoped_lock lock{latch_};
+    if (count == 0 || frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_) {
+        return;
+    }
+    bool evictable = heap_pos_[frame_id] >= 0;
+    if (evictable) {
+        heap_erase(heap_of(frame_id), frame_id);
+    }
+    for (size_t i = 0; i < std::min(count, k_); i++) {
+        history_[frame_id * k_ + access_cnt_[frame_id] % k_] = ++current_ts_;
+        access_cnt_[frame_id]++;
+    }
+    if (evictable) {
+        heap_push(heap_of(frame_id), frame_id);
+    }
+}
+
+/**
+ * @description: 将frame从replacer中移除并清空其访问历史，用于页面被删除、frame归还空闲链表的情况
+ * @param {frame_id_t} frame_id 被移除的frame的id
+ */
+void LRUKReplacer::remove(frame_id_t frame_id) {
+    std::scoped_lock lock{latch_};
+    if (frame_id < 0 || static_cast<size_t>(frame_id) >= max_size_) {
+        return;
+    }
+    if (heap_pos_[frame_id] >= 0) {
+        heap_erase(heap_of(frame_id), frame_id);
+    }
+    access_cnt_[frame_id] = 0;
+}
+
+/**
+ * @description: 按照淘汰顺序列出接下来会被淘汰的frame，不改变replacer的状态
+ * @param {size_t} max_count 最多列出的frame个数
+ * @return {vector<frame_id_t>} 第一个元素为下一个victim
+ */
+std::vector<frame_id_t> LRUKReplacer::eviction_candidates(size_t max_count) {
+    std::scoped_lock lock{latch_};
+    // 与victim的顺序相同：先列出访问不足k次的frame，再列出访问达到k次的frame
+    std::vector<frame_id_t> frame_ids;
+    list_candidates(inf_heap_, max_count, &frame_ids);
+    list_candidates(kdist_heap_, max_count, &frame_ids);
+    return frame_ids;
+}
+
+/**
+ * @description: 扩大replacer的容量，新的frame没有访问历史，容量不会缩小
+ * @param {size_t} num_pages 新的容量
+ */
+void LRUKReplacer::resize(size_t num_pages) {
+    std::scoped_lock lock{latch_};
+    if (num_pages <= max_size_) {
+        return;
+    }
+    history_.resize(num_pages * k_, 0);
+    access_cnt_.resize(num_pages, 0);
+    heap_pos_.resize(num_pages, -1);
+    inf_heap_.reserve(num_pages);
+    kdist_heap_.reserve(num_pages);
+    max_size_ = num_pages;
+}
+
+/**
+ * @description: 获取当前replacer中可以被淘汰的页面数量
+ */
+size_t LRUKReplacer::Size() {
+    std::scoped_lock lock{latch_};
+    return inf_heap_.size() + kdist_heap_.size();
+}
+
+/**
+ * @description: frame在堆中的排序键。访问不足k次时history_[f*k]为第一次访问；
+ *              访问达到k次时环形缓冲区中下一个写入位置保存的是倒数第k次访问。调用者需持有latch_
+ */
+uint64_t LRUKReplacer::key_of(frame_id_t frame_id) const {
+    size_t cnt = access_cnt_[frame_id];
+    return cnt < k_ ? history_[frame_id * k_] : history_[frame_id * k_ + cnt % k_];
+}
+
+/**
+ * @description: 按frame当前的访问次数返回它应当所在的堆。调用者需持有latch_
+ */
+std::vector<frame_id_t> &LRUKReplacer::heap_of(frame_id_t frame_id) {
+    return access_cnt_[frame_id] < k_ ? inf_heap_ : kdist_heap_;
+}
+
+/**
+ * @description: 把frame加入堆，frame之后可以被淘汰。调用者需持有latch_
+ */
+void LRUKReplacer::heap_push(std::vector<frame_id_t> &heap, frame_id_t frame_id) {
+    heap.push_back(frame_id);
+    heap_pos_[frame_id] = static_cast<int>(heap.size() - 1);
+    sift_up(heap, heap.size() - 1);
+}
+
+/**
+ * @description: 从堆中删除frame，用最后一个元素填补空位后重新调整。调用者需持有latch_
+ */
+void LRUKReplacer::heap_erase(std::vector<frame_id_t> &heap, frame_id_t frame_id) {
+    size_t pos = heap_pos_[frame_id];
+    heap_pos_[frame_id] = -1;
+    frame_id_t last = heap.back();
+    heap.pop_back();
+    if (pos == heap.size()) {
+        return;
+    }
+    heap_place(heap, pos, last);
+    sift_up(heap, pos);
+    sift_down(heap, heap_pos_[last]);
+}
+
+void LRUKReplacer::heap_place(std::vector<frame_id_t> &heap, size_t pos, frame_id_t frame_id) {
+    heap[pos] = frame_id;
+    heap_pos_[frame_id] = static_cast<int>(pos);
+}
+
+void LRUKReplacer::sift_up(std::vector<frame_id_t> &heap, size_t pos) {
+    frame_id_t frame_id = heap[pos];
+    uint64_t key = key_of(frame_id);
+    while (pos > 0 && key_of(heap[(pos - 1) / 2]) > key) {
+        heap_place(heap, pos, heap[(pos - 1) / 2]);
+        pos = (pos - 1) / 2;
+    }
+    heap_place(heap, pos, frame_id);
+}
+
+void LRUKReplacer::sift_down(std::vector<frame_id_t> &heap, size_t pos) {
+    frame_id_t frame_id = heap[pos];
+    uint64_t key = key_of(frame_id);
+    while (2 * pos + 1 < heap.size()) {
+        size_t child = 2 * pos + 1;
+        if (child + 1 < heap.size() && key_of(heap[child + 1]) < key_of(heap[child])) {
+            child++;
+        }
+        if (key_of(heap[child]) >= key) {
+            break;
+        }
+        heap_place(heap, pos, heap[child]);
+        pos = child;
+    }
+    heap_place(heap, pos, frame_id);
+}
+
+/**
+ * @description: 按排序键从小到大列出堆中的frame，直到frame_ids中有max_count个元素。
+ *              从堆顶开始，每取出一个元素就把它的两个子节点加入候选队列，只访问O(max_count)个节点。调用者需持有latch_
+ */
+void LRUKReplacer::list_candidates(const std::vector<frame_id_t> &heap, size_t max_count,
+                                   std::vector<frame_id_t> *frame_ids) {
+    using Entry = std::pair<uint64_t, size_t>;  // 排序键和堆中的下标
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> frontier;
+    if (!heap.empty()) {
+        frontier.push({key_of(heap[0]), 0});
+    }
+    while (!frontier.empty() && frame_ids->size() < max_count) {
+        size_t pos = frontier.top().second;
+        frontier.pop();
+        frame_ids->push_back(heap[pos]);
+        for (size_t child = 2 * pos + 1; child <= 2 * pos + 2 && child < heap.size(); child++) {
+            frontier.push({key_of(heap[child]), child});
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "common/config.h"
+#include "replacer/replacer.h"
+
+/*
+LRUKReplacer实现了LRU-K替换策略：淘汰backward k-distance(当前时间与倒数第k次访问时间之差)最大的frame。
+访问次数不足k次的frame的k-distance视为无穷大，优先被淘汰，它们之间按照第一次访问的时间先后淘汰。
+因此只被顺序扫描访问过一次的页面会先于被多次访问的热点页面被淘汰。
+每次pin视为对frame的一次访问，缓冲池不获取互斥锁的命中由record_access补记，访问历史保存在以frame_id为下标的定长数组中。
+可以被淘汰的frame按访问次数分别放在两个以时间戳为键的二叉最小堆中，淘汰和列出候选帧不需要扫描所有frame
+*/
+class LRUKReplacer : public Replacer {
+   public:
+    /**
+     * @description: 创建一个新的LRUKReplacer
+     * @param {size_t} num_pages LRUKReplacer最多需要存储的page数量
+     * @param {size_t} k 计算backward k-distance时使用的k
+     */
+    LRUKReplacer(size_t num_pages, size_t k);
+
+    ~LRUKReplacer();
+
+    bool victim(frame_id_t *frame_id);
+
+    void pin(frame_id_t frame_id);
+
+    void unpin(frame_id_t frame_id);
+
+    void record_access(frame_id_t frame_id, size_t count);
+
+    void remove(frame_id_t frame_id);
+
+    std::vector<frame_id_t> eviction_candidates(size_t max_count);
+
+    void resize(size_t num_pages);
+
+    size_t Size();
+
+   private:
+    uint64_t key_of(frame_id_t frame_id) const;
+
+    std::vector<frame_id_t> &heap_of(frame_id_t frame_id);
+
+    void heap_push(std::vector<frame_id_t> &heap, frame_id_t frame_id);
+
+    void heap_erase(std::vector<frame_id_t> &heap, frame_id_t frame_id);
+
+    void heap_place(std::vector<frame_id_t> &heap, size_t pos, frame_id_t frame_id);
+
+    void sift_up(std::vector<frame_id_t> &heap, size_t pos);
+
+    void sift_down(std::vector<frame_id_t> &heap, size_t pos);
+
+    void list_candidates(const std::vector<frame_id_t> &heap, size_t max_count, std::vector<frame_id_t> *frame_ids);
+
+    std::mutex latch_;                  // 互斥锁
+    size_t k_;
+    std::vector<uint64_t> history_;     // 每个frame最近k次访问的时间戳，frame f占用[f*k, f*k+k)，按环形缓冲区使用
+    std::vector<uint64_t> access_cnt_;  // 每个frame的访问次数，用于定位环形缓冲区中最旧的时间戳
+    std::vector<frame_id_t> inf_heap_;  // 访问不足k次的可淘汰frame，按第一次访问的时间排序
+    std::vector<frame_id_t> kdist_heap_;    // 访问达到k次的可淘汰frame，按倒数第k次访问的时间排序
+    std::vector<int> heap_pos_;         // 每个frame在所在堆中的下标，不可淘汰(不在堆中)时为-1
+    uint64_t current_ts_;               // 逻辑时钟，每次访问加一
+    size_t max_size_;   // 最大容量（与缓冲池的容量相同）
+};
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #include "lru_replacer.h"
 
+#include <algorithm>
+
 LRUReplacer::LRUReplacer(size_t num_pages) { max_size_ = num_pages; }
 
 LRUReplacer::~LRUReplacer() = default;  
@@ -24,10 +26,13 @@ bool LRUReplacer::victim(frame_id_t* frame_id) {
     // 它能够避免死锁发生，其构造函数能够自动进行上锁操作，析构函数会对互斥量进行解锁操作，保证线程安全。
     std::scoped_lock lock{latch_};  //  如果编译报错可以替换成其他lock
 
-    // Todo:
-    //  利用lru_replacer中的LRUlist_,LRUHash_实现LRU策略
-    //  选择合适的frame指定为淘汰页面,赋值给*frame_id
-
+    // LRUlist_首部为最近被访问的frame，因此从尾部淘汰
+    if (LRUlist_.empty()) {
+        return false;
+    }
+    *frame_id = LRUlist_.back();
+    LRUhash_.erase(*frame_id);
+    LRUlist_.pop_back();
     return true;
 }
 
@@ -37,9 +42,13 @@ bool LRUReplacer::victim(frame_id_t* frame_id) {
  */
 void LRUReplacer::pin(frame_id_t frame_id) {
     std::scoped_lock lock{latch_};
-    // Todo:
-    // 固定指定id的frame
-    // 在数据结构中移除该frame
+    // 固定指定id的frame，在数据结构中移除该frame
+    auto pos = LRUhash_.find(frame_id);
+    if (pos == LRUhash_.end()) {
+        return;
+    }
+    LRUlist_.erase(pos->second);
+    LRUhash_.erase(pos);
 }
 
 /**
@@ -47,12 +56,56 @@ void LRUReplacer::pin(frame_id_t frame_id) {
  * @param {frame_id_t} frame_id 取消固定的frame的id
  */
 void LRUReplacer::unpin(frame_id_t frame_id) {
-    // Todo:
-    //  支持并发锁
-    //  选择一个frame取消固定
+    std::scoped_lock lock{latch_};
+    // 已经在replacer中的frame不改变其位置
+    if (LRUhash_.count(frame_id) || LRUlist_.size() >= max_size_) {
+        return;
+    }
+    LRUlist_.push_front(frame_id);
+    LRUhash_[frame_id] = LRUlist_.begin();
+}
+
+/**
+ * @description: 记录在replacer之外统计的访问，可以被淘汰的frame移到链表首部
+ * @param {frame_id_t} frame_id 被访问的frame的id
+ * @param {size_t} count 访问次数
+ */
+void LRUReplacer::record_access(frame_id_t frame_id, size_t count) {
+    std::scoped_lock lock{latch_};
+    auto pos = LRUhash_.find(frame_id);
+    if (count == 0 || pos == LRUhash_.end()) {
+        return;
+    }
+    LRUlist_.splice(LRUlist_.begin(), LRUlist_, pos->second);
+}
+
+/**
+ * @description: 按照淘汰顺序列出接下来会被淘汰的frame，不改变replacer的状态
+ * @param {size_t} max_count 最多列出的frame个数
+ * @return {vector<frame_id_t>} 第一个元素为下一个victim
+ */
+std::vector<frame_id_t> LRUReplacer::eviction_candidates(size_t max_count) {
+    std::scoped_lock lock{latch_};
+    std::vector<frame_id_t> frame_ids;
+    for (auto it = LRUlist_.rbegin(); it != LRUlist_.rend() && frame_ids.size() < max_count; ++it) {
+        frame_ids.push_back(*it);
+    }
+    return frame_ids;
+}
+
+/**
+ * @description: 扩大replacer的容量，容量不会缩小
+ * @param {size_t} num_pages 新的容量
+ */
+void LRUReplacer::resize(size_t num_pages) {
+    std::scoped_lock lock{latch_};
+    max_size_ = std::max(max_size_, num_pages);
 }
 
 /**
  * @description: 获取当前replacer中可以被淘汰的页面数量
  */
-size_t LRUReplacer::Size() { return LRUlist_.size(); }
+size_t LRUReplacer::Size() {
+    std::scoped_lock lock{latch_};
+    return LRUlist_.size();
+}
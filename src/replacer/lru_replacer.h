@@ -37,6 +37,12 @@ class LRUReplacer : public Replacer {
 
     void unpin(frame_id_t frame_id);
 
+    void record_access(frame_id_t frame_id, size_t count);
+
+    std::vector<frame_id_t> eviction_candidates(size_t max_count);
+
+    void resize(size_t num_pages);
+
     size_t Size();
 
    private:
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <vector>
+
 #include "common/config.h"
 
 /**
@@ -33,12 +35,40 @@ class Replacer {
      */
     virtual void pin(frame_id_t frame_id) = 0;
 
+    /**
+     * Records accesses that were counted outside the replacer, e.g. buffer pool hits that pinned the frame
+     * without taking any mutex. Does not change whether the frame can be victimized.
+     * @param frame_id the id of the accessed frame
+     * @param count the number of accesses since they were last recorded
+     */
+    virtual void record_access(frame_id_t frame_id, size_t count) = 0;
+
     /**
      * Unpins a frame, indicating that it can now be victimized.
      * @param frame_id the id of the frame to unpin
      */
     virtual void unpin(frame_id_t frame_id) = 0;
 
+    /**
+     * Removes a frame from the replacer and forgets its access history, e.g. when its page is deleted.
+     * @param frame_id the id of the frame to remove
+     */
+    virtual void remove(frame_id_t frame_id) { pin(frame_id); }
+
+    /**
+     * Lists the frames that would be victimized next, in eviction order, without removing them from the replacer.
+     * @param max_count the maximum number of frames to list
+     * @return up to max_count frame ids, the first one is the next victim
+     */
+    virtual std::vector<frame_id_t> eviction_candidates(size_t max_count) = 0;
+
+    /**
+     * Grows the replacer so that it can track frame ids in [0, num_pages), e.g. when the buffer pool is resized.
+     * The capacity never shrinks, frames beyond the pool are simply never unpinned.
+     * @param num_pages the new capacity
+     */
+    virtual void resize(size_t num_pages) = 0;
+
     /** @return the number of elements in the replacer that can be victimized */
     virtual size_t Size() = 0;
 };
@@ -0,0 +1,383 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "async_io.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "io_worker_pool.h"
+
+#ifdef RMDB_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace {
+
+/**
+ * @description: 同步执行一个连续页面请求中从done开始的剩余部分，每次系统调用最多读写IOV_MAX个缓冲区
+ * @return {ssize_t} 读写的总字节数，出错时为-errno
+ */
+ssize_t do_vector_request(const AsyncIoRequest &req, ssize_t done) {
+    off_t offset = static_cast<off_t>(req.page_no) * PAGE_SIZE;
+    std::vector<iovec> iovs;
+    while (done < req.num_bytes) {
+        // 跳过已经完成的页面，第一个页面可能只完成了一部分
+        iovs.clear();
+        size_t first = done / PAGE_SIZE;
+        size_t skip = done % PAGE_SIZE;
+        for (size_t i = first; i < req.bufs.size() && iovs.size() < IOV_MAX; i++) {
+            size_t start = i == first ? skip : 0;
+            iovs.push_back(iovec{req.bufs[i] + start, PAGE_SIZE - start});
+        }
+        ssize_t n = req.is_write ? pwritev(req.fd, iovs.data(), static_cast<int>(iovs.size()), offset + done)
+                                 : preadv(req.fd, iovs.data(), static_cast<int>(iovs.size()), offset + done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break;  // 读到文件末尾
+        done += n;
+    }
+    return done;
+}
+
+/**
+ * @description: 同步执行一个请求中从done开始的剩余部分，处理被信号打断和短读写的情况
+ * @return {ssize_t} 读写的总字节数，出错时为-errno
+ */
+ssize_t do_request(const AsyncIoRequest &req, ssize_t done = 0) {
+    off_t offset = static_cast<off_t>(req.page_no) * PAGE_SIZE;
+    if (!req.bufs.empty()) {
+        return do_vector_request(req, done);
+    }
+    while (done < req.num_bytes) {
+        ssize_t n = req.is_write ? pwrite(req.fd, req.buf + done, req.num_bytes - done, offset + done)
+                                 : pread(req.fd, req.buf + done, req.num_bytes - done, offset + done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break;  // 读到文件末尾
+        done += n;
+    }
+    return done;
+}
+
+/**
+ * @description: pread/pwrite线程池后端，每个请求由一个工作线程同步执行
+ */
+class ThreadPoolIo : public AsyncIo {
+   public:
+    explicit ThreadPoolIo(size_t num_threads) : workers_(num_threads) {}
+
+    void submit(std::vector<AsyncIoRequest> requests) override {
+        for (auto &req : requests) {
+            workers_.submit([req = std::move(req)]() {
+                ssize_t res = do_request(req);
+                if (req.callback) req.callback(res);
+            });
+        }
+    }
+
+    std::string name() const override { return "thread_pool"; }
+
+   private:
+    IoWorkerPool workers_;
+};
+
+#ifdef RMDB_HAVE_IO_URING
+
+int sys_io_uring_setup(unsigned entries, io_uring_params *p) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+/**
+ * @description: 基于io_uring的后端，直接使用系统调用而不依赖liburing。
+ * 提交线程在互斥锁保护下填写SQE并调用一次io_uring_enter提交整批请求；
+ * 一个收割线程阻塞等待CQE并调用回调。CQE被取走后它的slot才能复用，在途请求与未取走的CQE合计不超过CQ的大小，避免CQ溢出
+ */
+class UringIo : public AsyncIo {
+   public:
+    static std::unique_ptr<UringIo> create(unsigned queue_depth) {
+        std::unique_ptr<UringIo> io(new UringIo());
+        if (!io->init(queue_depth)) {
+            return nullptr;
+        }
+        io->reaper_ = std::thread(&UringIo::reap_loop, io.get());
+        return io;
+    }
+
+    ~UringIo() override {
+        if (reaper_.joinable()) {
+            // 提交一个NOP唤醒收割线程，收割线程看到STOP_USER_DATA后退出。NOP使用预留的CQ位置，不占用slot
+            {
+                std::scoped_lock lock{latch_};
+                io_uring_sqe *sqe = next_sqe();
+                sqe->opcode = IORING_OP_NOP;
+                sqe->user_data = STOP_USER_DATA;
+                push_sqe();
+                sys_io_uring_enter(ring_fd_, 1, 0, 0);
+            }
+            reaper_.join();
+        }
+        if (sqes_ != MAP_FAILED && sqes_ != nullptr) munmap(sqes_, sqes_size_);
+        if (cq_ptr_ != MAP_FAILED && cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) munmap(cq_ptr_, cq_size_);
+        if (sq_ptr_ != MAP_FAILED && sq_ptr_ != nullptr) munmap(sq_ptr_, sq_size_);
+        if (ring_fd_ >= 0) close(ring_fd_);
+    }
+
+    void submit(std::vector<AsyncIoRequest> requests) override {
+        size_t i = 0;
+        while (i < requests.size()) {
+            std::unique_lock lock{latch_};
+            slot_cv_.wait(lock, [this] { return !free_slots_.empty(); });
+            // 在一次io_uring_enter中提交尽可能多的请求，SQ中可能还有其他线程在重试期间填写的SQE
+            while (i < requests.size() && !free_slots_.empty() &&
+                   *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) < sq_entries_) {
+                unsigned slot_id = free_slots_.back();
+                free_slots_.pop_back();
+                Slot &slot = slots_[slot_id];
+                slot.req = std::move(requests[i++]);
+                slot.iovs.clear();
+                if (slot.req.bufs.empty()) {
+                    slot.iovs.push_back(iovec{slot.req.buf, static_cast<size_t>(slot.req.num_bytes)});
+                } else {
+                    for (char *buf : slot.req.bufs) {
+                        slot.iovs.push_back(iovec{buf, PAGE_SIZE});
+                    }
+                }
+
+                io_uring_sqe *sqe = next_sqe();
+                sqe->opcode = slot.req.is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+                sqe->fd = slot.req.fd;
+                sqe->addr = reinterpret_cast<uint64_t>(slot.iovs.data());
+                sqe->len = static_cast<unsigned>(slot.iovs.size());
+                sqe->off = static_cast<uint64_t>(slot.req.page_no) * PAGE_SIZE;
+                sqe->user_data = slot_id;
+                push_sqe();
+            }
+            std::vector<AsyncIoRequest> failed;
+            int err = enter_all(lock, &failed);
+            lock.unlock();
+            // 没能提交的请求在锁外以错误码完成，等待它们的调用者不会一直阻塞
+            for (auto &req : failed) {
+                if (req.callback) req.callback(-err);
+            }
+        }
+    }
+
+    std::string name() const override { return "io_uring"; }
+
+   private:
+    static constexpr uint64_t STOP_USER_DATA = ~0ULL;
+    static constexpr int URING_RETRY_US = 50;  // io_uring_enter暂时无法接收请求时的重试间隔
+
+    struct Slot {
+        AsyncIoRequest req;
+        std::vector<iovec> iovs;    // 单个缓冲区的请求只有一个元素
+    };
+
+    UringIo() = default;
+
+    bool init(unsigned queue_depth) {
+        io_uring_params params{};
+        ring_fd_ = sys_io_uring_setup(queue_depth, &params);
+        if (ring_fd_ < 0) {
+            return false;
+        }
+        sq_entries_ = params.sq_entries;
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+        }
+        sq_ptr_ = mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                       IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) return false;
+        cq_ptr_ = single_mmap ? sq_ptr_
+                              : mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                                     IORING_OFF_CQ_RING);
+        if (cq_ptr_ == MAP_FAILED) return false;
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe *>(
+            mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+        if (sqes_ == MAP_FAILED) return false;
+
+        char *sq = static_cast<char *>(sq_ptr_);
+        sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        char *cq = static_cast<char *>(cq_ptr_);
+        cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+        // 预留一个CQ位置给析构时的NOP
+        slots_.resize(params.cq_entries - 1);
+        for (unsigned i = 0; i + 1 < params.cq_entries; i++) {
+            free_slots_.push_back(i);
+        }
+        return true;
+    }
+
+    /**
+     * @description: 调用io_uring_enter直到内核取走SQ中所有已经填写的SQE。内核只取走一部分、被信号打断、
+     *              或暂时无法接收(EAGAIN/EBUSY，例如CQ已满)时重试，重试前释放latch_让收割线程取走CQE；
+     *              SQ中待提交的个数每次从环上重新计算，其他线程在此期间填写的SQE也会一起提交。
+     *              其他错误时收回没有被取走的SQE，归还它们的slot，请求移到failed中由调用者在锁外完成
+     * @return {int} 成功时为0，否则为errno
+     * @param {unique_lock&} lock 持有latch_的锁
+     * @param {vector<AsyncIoRequest>*} failed 追加没有提交成功的请求
+     */
+    int enter_all(std::unique_lock<std::mutex> &lock, std::vector<AsyncIoRequest> *failed) {
+        while (true) {
+            unsigned pending = *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            if (pending == 0) {
+                return 0;
+            }
+            int ret = sys_io_uring_enter(ring_fd_, pending, 0, 0);
+            if (ret > 0) {
+                continue;
+            }
+            int err = ret < 0 ? errno : EAGAIN;
+            if (err == EINTR) {
+                continue;
+            }
+            if (err == EAGAIN || err == EBUSY) {
+                lock.unlock();
+                std::this_thread::sleep_for(std::chrono::microseconds(URING_RETRY_US));
+                lock.lock();
+                continue;
+            }
+            // 没有SQPOLL时内核只在io_uring_enter中读取SQ，可以把尾指针退回到头指针
+            unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            for (unsigned idx = head; idx != *sq_tail_; idx++) {
+                auto slot_id = static_cast<unsigned>(sqes_[sq_array_[idx & sq_mask_]].user_data);
+                failed->push_back(std::move(slots_[slot_id].req));
+                free_slots_.push_back(slot_id);
+            }
+            __atomic_store_n(sq_tail_, head, __ATOMIC_RELEASE);
+            slot_cv_.notify_all();
+            return err;
+        }
+    }
+
+    io_uring_sqe *next_sqe() {
+        unsigned tail = *sq_tail_;
+        io_uring_sqe *sqe = &sqes_[tail & sq_mask_];
+        *sqe = io_uring_sqe{};
+        return sqe;
+    }
+
+    void push_sqe() {
+        unsigned tail = *sq_tail_;
+        sq_array_[tail & sq_mask_] = tail & sq_mask_;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    }
+
+    void reap_loop() {
+        while (true) {
+            unsigned head = *cq_head_;
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            if (head == tail) {
+                int ret = sys_io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+                if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    return;
+                }
+                continue;
+            }
+            bool stop = false;
+            for (; head != tail; head++) {
+                io_uring_cqe &cqe = cqes_[head & cq_mask_];
+                uint64_t user_data = cqe.user_data;
+                ssize_t res = cqe.res;
+                // 先把这个CQE还给内核，再释放它的槽位，保证在途请求数加上未消费的CQE数不超过完成队列大小
+                __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+                if (user_data == STOP_USER_DATA) {
+                    stop = true;
+                    continue;
+                }
+                Slot &slot = slots_[user_data];
+                AsyncIoRequest req = std::move(slot.req);
+                // 短读写时用同步I/O补齐剩余部分，与线程池后端的语义保持一致
+                if (res > 0 && res < req.num_bytes) {
+                    res = do_request(req, res);
+                }
+                if (req.callback) req.callback(res);
+                {
+                    std::scoped_lock lock{latch_};
+                    free_slots_.push_back(static_cast<unsigned>(user_data));
+                }
+                slot_cv_.notify_one();
+            }
+            if (stop) {
+                return;
+            }
+        }
+    }
+
+    int ring_fd_ = -1;
+    unsigned sq_entries_ = 0;
+    void *sq_ptr_ = nullptr;
+    void *cq_ptr_ = nullptr;
+    size_t sq_size_ = 0;
+    size_t cq_size_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned *sq_head_ = nullptr;
+    unsigned *sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned *sq_array_ = nullptr;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe *cqes_ = nullptr;
+
+    std::mutex latch_;                  // 保护SQ和free_slots_
+    std::condition_variable slot_cv_;   // 有空闲slot时通知提交线程
+    std::vector<Slot> slots_;           // 在途请求，下标即user_data
+    std::vector<unsigned> free_slots_;
+    std::thread reaper_;
+};
+
+#endif
+
+}  // namespace
+
+std::unique_ptr<AsyncIo> AsyncIo::create(unsigned queue_depth) {
+#ifdef RMDB_HAVE_IO_URING
+    if (auto io = UringIo::create(queue_depth)) {
+        return io;
+    }
+#endif
+    return create_thread_pool(IO_WORKER_THREADS);
+}
+
+std::unique_ptr<AsyncIo> AsyncIo::create_thread_pool(size_t num_threads) {
+    return std::make_unique<ThreadPoolIo>(num_threads);
+}
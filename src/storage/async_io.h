@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * @description: 一个异步页面读写请求。请求完成后在I/O后端的线程中调用callback，
+ * 参数为读写的字节数，出错时为-errno。buf在请求完成之前必须保持有效。
+ * bufs非空时请求读写从page_no开始的bufs.size()个连续页面(preadv/pwritev)，
+ * 第i个页面的数据位于bufs[i]，忽略buf，num_bytes应为bufs.size() * PAGE_SIZE
+ */
+struct AsyncIoRequest {
+    int fd;                 // 文件句柄
+    page_id_t page_no;      // 页面号，读写位置为page_no * PAGE_SIZE
+    char *buf;              // 读写缓冲区
+    int num_bytes;          // 读写的字节数
+    bool is_write;          // true表示写，false表示读
+    std::function<void(ssize_t)> callback;  // 完成回调，可以为空
+    std::vector<char *> bufs;               // 连续页面的读写缓冲区，为空时使用buf
+};
+
+/**
+ * @description: 异步I/O后端。submit一次提交一批请求，尽量只用一次系统调用；
+ * 优先使用io_uring，io_uring不可用时(编译环境没有<linux/io_uring.h>或内核不支持)退化为pread/pwrite线程池
+ */
+class AsyncIo {
+   public:
+    virtual ~AsyncIo() = default;
+
+    /**
+     * @description: 提交一批请求，立即返回，每个请求完成时调用其callback。
+     *              io_uring后端中提交线程退出时内核会取消它提交的未完成请求(回调以-ECANCELED完成)，
+     *              提交线程应当在退出之前等待请求完成
+     * @param {vector<AsyncIoRequest>} requests 要提交的请求
+     */
+    virtual void submit(std::vector<AsyncIoRequest> requests) = 0;
+
+    /** @return 后端的名称，"io_uring"或"thread_pool" */
+    virtual std::string name() const = 0;
+
+    /**
+     * @description: 创建一个异步I/O后端，io_uring创建失败时使用线程池
+     * @param {unsigned} queue_depth 同时在途的最大请求数
+     */
+    static std::unique_ptr<AsyncIo> create(unsigned queue_depth);
+
+    /**
+     * @description: 创建pread/pwrite线程池后端
+     * @param {size_t} num_threads 线程数
+     */
+    static std::unique_ptr<AsyncIo> create_thread_pool(size_t num_threads);
+};
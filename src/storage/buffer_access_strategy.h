@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <vector>
+
+#include "common/config.h"
+
+class BufferPoolManager;
+
+/**
+ * @description: 一个缓冲池分区中属于某个BufferAccessStrategy的帧环。
+ * 环中的帧在unpin之后不会交给分区的replacer，而是由持有环的扫描循环复用
+ */
+struct BufferRing {
+    std::vector<frame_id_t> frames;     // 环中的帧
+    size_t capacity = 0;                // 环中最多容纳的帧数
+    size_t next = 0;                    // 下一次复用的位置
+};
+
+/**
+ * @description: 缓冲区访问策略。大表的顺序扫描通过它使用一小组私有的帧：
+ * 读入新页面时优先复用环中已经unpin的帧，而不是从共享的replacer中淘汰页面，
+ * 因此一次全表扫描不会把其他事务的热点页面挤出缓冲池。
+ * 策略对象析构时，环中的帧归还给各个分区的replacer
+ */
+class BufferAccessStrategy {
+    friend class BufferPoolManager;
+
+   private:
+    BufferPoolManager *buffer_pool_manager_;
+    std::vector<BufferRing> rings_;     // 每个缓冲池分区一个环，下标与分区下标相同
+
+   public:
+    /**
+     * @description: 创建一个访问策略，环的总大小平均分配到各个缓冲池分区
+     * @param {BufferPoolManager*} buffer_pool_manager 使用该策略的缓冲池
+     * @param {size_t} ring_size 环中帧的总数
+     */
+    BufferAccessStrategy(BufferPoolManager *buffer_pool_manager, size_t ring_size);
+
+    ~BufferAccessStrategy();
+
+    BufferAccessStrategy(const BufferAccessStrategy &) = delete;
+    BufferAccessStrategy &operator=(const BufferAccessStrategy &) = delete;
+};
@@ -0,0 +1,702 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "buffer_pool_instance.h"
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @description: 从free_list或replacer中得到可淘汰帧页的 *frame_id
+ * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
+ * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
+ */
+bool BufferPoolInstance::find_victim_page(frame_id_t* frame_id) {
+    // 1 使用free_list_判断缓冲池是否已满需要淘汰页面
+    // 1.1 未满获得frame
+    if (!free_list_.empty()) {
+        *frame_id = free_list_.front();
+        free_list_.pop_front();
+        return true;
+    }
+    // 1.2 已满使用replacer中的方法选择淘汰页面，跳过在选中之后被无锁路径固定的帧，这些帧在unpin时重新交给replacer
+    while (replacer_->victim(frame_id)) {
+        if (detach_frame(*frame_id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @description: 把帧中的页面从页表中移除，之后fetch_page的无锁路径不会再固定该帧。
+ *              先删除映射再检查pin_count_，与无锁路径先固定再确认映射的顺序相对，
+ *              两者之中至少有一方能看到另一方的操作；若帧已经被固定，则恢复映射并返回false。调用者需持有latch_
+ * @return {bool} true: 帧中不再有可以被访问的页面, false: 帧仍被固定
+ * @param {frame_id_t} frame_id 要淘汰的帧
+ */
+bool BufferPoolInstance::detach_frame(frame_id_t frame_id) {
+    Page *page = get_frame(frame_id);
+    if (page->id_.page_no == INVALID_PAGE_ID) {
+        return true;
+    }
+    page_table_.erase(page->id_);
+    if (page->pin_count_.load() != 0) {
+        page_table_.insert(page->id_, frame_id);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @description: 为使用BufferAccessStrategy的扫描获取一个帧。
+ *              环未满时从free_list或replacer中获取新帧加入环；环已满时复用环中下一个帧，
+ *              若该帧仍被固定或已不属于该环，则另取一个新帧替换它，旧帧交还给replacer
+ * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
+ * @param {BufferRing*} ring 扫描在当前分区的帧环
+ * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
+ */
+bool BufferPoolInstance::find_ring_page(BufferRing *ring, frame_id_t* frame_id) {
+    if (ring->frames.size() < ring->capacity) {
+        if (!find_victim_page(frame_id)) {
+            return false;
+        }
+        ring_owner_[*frame_id] = ring;
+        ring->frames.push_back(*frame_id);
+        return true;
+    }
+    size_t pos = ring->next;
+    ring->next = (ring->next + 1) % ring->frames.size();
+    frame_id_t old_frame_id = ring->frames[pos];
+    if (ring_owner_[old_frame_id] == ring && get_frame(old_frame_id)->pin_count_ == 0 && detach_frame(old_frame_id)) {
+        *frame_id = old_frame_id;
+        return true;
+    }
+    if (!find_victim_page(frame_id)) {
+        return false;
+    }
+    // 旧帧仍被其他线程固定，交还给replacer，之后unpin时按普通帧处理
+    if (ring_owner_[old_frame_id] == ring) {
+        ring_owner_[old_frame_id] = nullptr;
+        if (get_frame(old_frame_id)->pin_count_ == 0) {
+            release_frame(old_frame_id);
+        }
+    }
+    ring_owner_[*frame_id] = ring;
+    ring->frames[pos] = *frame_id;
+    return true;
+}
+
+/**
+ * @description: 更新页面数据, 如果为脏页则需写入磁盘，再更新为新页面，更新page元数据(data, is_dirty, page_id)。
+ *              帧中原来的页面已经由detach_frame从page table中移除；新页面的内容准备好之后，由调用者加入page table
+ * @param {Page*} page 写回页指针
+ * @param {PageId} new_page_id 新的page_id
+ */
+void BufferPoolInstance::update_page(Page *page, PageId new_page_id) {
+    // 1 如果是脏页，写回磁盘，并且把dirty置为false
+    if (page->is_dirty_) {
+        disk_manager_->write_page(page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE);
+        disk_manager_->record_event(page->id_.fd, DIRTY_WRITEBACKS);
+        page->is_dirty_ = false;
+    }
+    if (page->id_.page_no != INVALID_PAGE_ID && new_page_id.page_no != INVALID_PAGE_ID) {
+        disk_manager_->record_event(page->id_.fd, EVICTIONS);
+    }
+    // 2 重置page的data，更新page id，原来页面的命中次数不再有意义
+    page->reset_memory();
+    page->id_ = new_page_id;
+    page->hits_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @description: 把pin_count_刚刚降为0的帧交还给replacer，同时把无锁路径累计的命中次数交给replacer。
+ *              属于帧环的帧由环复用，只清空命中次数。调用者需持有latch_
+ * @param {frame_id_t} frame_id pin_count_降为0的帧
+ */
+void BufferPoolInstance::release_frame(frame_id_t frame_id) {
+    uint8_t hits = get_frame(frame_id)->hits_.exchange(0, std::memory_order_relaxed);
+    if (ring_owner_[frame_id] != nullptr) {
+        return;
+    }
+    if (hits > 0) {
+        replacer_->record_access(frame_id, hits);
+    }
+    replacer_->unpin(frame_id);
+}
+
+/**
+ * @description: 从当前分区获取需要的页。
+ *              如果页表中存在page_id（说明该page在缓冲池中），不获取latch_，固定该帧后再次确认映射没有变化即可返回。
+ *              命中也不获取replacer的互斥锁，访问次数记在帧描述符上，pin_count_降为0时由release_frame交给replacer；
+ *              帧在此期间仍留在replacer中，被选为victim时由detach_frame发现已被固定而跳过
+ *              如果页表不存在page_id（说明该page在磁盘中），则找缓冲池victim page，将其替换为磁盘中读取的page，pin_count置1。
+ * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
+ * @param {PageId} page_id 需要获取的页的PageId
+ * @param {BufferRing*} ring 非空时页面读入扫描私有的帧环，不从replacer中淘汰页面
+ */
+Page* BufferPoolInstance::fetch_page(PageId page_id, BufferRing *ring) {
+    // 1.     无锁地从page_table_中搜寻目标页
+    // 1.1    若目标页有被page_table_记录，则先固定其所在frame，再确认映射没有被淘汰过程删除，确认后返回目标页
+    frame_id_t frame_id;
+    if (page_table_.find(page_id, &frame_id)) {
+        Page *page = get_frame(frame_id);
+        page->pin_count_++;
+        frame_id_t check_id;
+        if (page_table_.find(page_id, &check_id) && check_id == frame_id) {
+            if (page->hits_.load(std::memory_order_relaxed) < UINT8_MAX) {
+                page->hits_.fetch_add(1, std::memory_order_relaxed);
+            }
+            disk_manager_->record_event(page_id.fd, FETCH_HITS);
+            return page;
+        }
+        // 目标页在固定之前被淘汰，撤销固定后按未命中处理
+        std::scoped_lock lock{latch_};
+        if (--page->pin_count_ == 0 && page->id_.page_no != INVALID_PAGE_ID) {
+            release_frame(frame_id);
+        }
+    }
+    std::scoped_lock lock{latch_};
+    // 1.2    获取latch_之后再查找一次，其他线程可能已经读入了目标页
+    if (page_table_.find(page_id, &frame_id)) {
+        Page *page = get_frame(frame_id);
+        page->pin_count_++;
+        replacer_->pin(frame_id);
+        disk_manager_->record_event(page_id.fd, FETCH_HITS);
+        return page;
+    }
+    // 1.3    否则，尝试调用find_victim_page获得一个可用的frame，若失败则返回nullptr
+    uint64_t start_us = io_stats_now_us();
+    if (ring != nullptr ? !find_ring_page(ring, &frame_id) : !find_victim_page(&frame_id)) {
+        return nullptr;
+    }
+    // 2.     若获得的可用frame存储的为dirty page，则须调用updata_page将page写回到磁盘
+    Page *page = get_frame(frame_id);
+    update_page(page, page_id);
+    // 3.     调用disk_manager_的read_page读取目标页到frame，读取失败时把帧归还free_list_
+    try {
+        disk_manager_->read_page(page_id.fd, page_id.page_no, page->data_, PAGE_SIZE);
+    } catch (RMDBError &) {
+        page->id_.page_no = INVALID_PAGE_ID;
+        if (ring_owner_[frame_id] == nullptr) {
+            replacer_->remove(frame_id);
+            free_list_.push_back(frame_id);
+        }
+        throw;
+    }
+    // 4.     固定目标页，更新pin_count_，页面读入之后才加入page_table_，无锁路径不会看到未读完的页面。
+    //        pin_count_可能已经被持有旧映射的无锁路径暂时增加，因此用自增而不是赋值
+    page->pin_count_++;
+    replacer_->pin(frame_id);
+    page_table_.insert(page_id, frame_id);
+    disk_manager_->record_event(page_id.fd, FETCH_MISSES);
+    disk_manager_->record_miss_latency(io_stats_now_us() - start_us);
+    // 5.     返回目标页
+    return page;
+}
+
+/**
+ * @description: 取消固定pin_count>0的在缓冲池中的page
+ * @return {bool} 如果目标页的pin_count<=0则返回false，否则返回true
+ * @param {PageId} page_id 目标page的page_id
+ * @param {bool} is_dirty 若目标page应该被标记为dirty则为true，否则为false
+ */
+bool BufferPoolInstance::unpin_page(PageId page_id, bool is_dirty) {
+    // 0. lock latch
+    std::scoped_lock lock{latch_};
+    // 1. 尝试在page_table_中搜寻page_id对应的页P
+    // 1.1 P在页表中不存在 return false
+    frame_id_t frame_id;
+    if (!page_table_.find(page_id, &frame_id)) {
+        return false;
+    }
+    // 1.2 P在页表中存在，获取其pin_count_
+    Page *page = get_frame(frame_id);
+    // 2.1 若pin_count_已经等于0，则返回false
+    if (page->pin_count_ <= 0) {
+        return false;
+    }
+    // 2.2 若pin_count_大于0，则pin_count_自减一
+    // 2.2.1 若自减后等于0，则调用replacer_的Unpin，属于帧环的帧由环复用，不交给replacer
+    if (--page->pin_count_ == 0) {
+        release_frame(frame_id);
+    }
+    // 3 根据参数is_dirty，更改P的is_dirty_
+    if (is_dirty) {
+        page->is_dirty_ = true;
+    }
+    return true;
+}
+
+/**
+ * @description: 将目标页写回磁盘，不考虑当前页面是否正在被使用
+ * @return {bool} 成功则返回true，否则返回false(只有page_table_中没有目标页时)
+ * @param {PageId} page_id 目标页的page_id，不能为INVALID_PAGE_ID
+ */
+bool BufferPoolInstance::flush_page(PageId page_id) {
+    // 0. lock latch
+    std::scoped_lock lock{latch_};
+    // 1. 查找页表,尝试获取目标页P
+    // 1.1 目标页P没有被page_table_记录 ，返回false
+    frame_id_t frame_id;
+    if (!page_table_.find(page_id, &frame_id)) {
+        return false;
+    }
+    // 2. 无论P是否为脏都将其写回磁盘。
+    Page *page = get_frame(frame_id);
+    disk_manager_->write_page(page_id.fd, page_id.page_no, page->data_, PAGE_SIZE);
+    disk_manager_->record_event(page_id.fd, FLUSHED_PAGES);
+    // 3. 更新P的is_dirty_
+    page->is_dirty_ = false;
+    return true;
+}
+
+/**
+ * @description: 创建一个新的page，即从磁盘中移动一个新建的空page到缓冲池某个位置。
+ * @return {Page*} 返回新创建的page，若创建失败则返回nullptr
+ * @param {PageId*} page_id 当成功创建一个新的page时存储其page_id
+ */
+Page* BufferPoolInstance::new_page(PageId* page_id) {
+    std::scoped_lock lock{latch_};
+    // 1.   在fd对应的文件分配一个新的page_id，可能复用已经释放的页号
+    page_id->page_no = disk_manager_->allocate_page(page_id->fd);
+    // 2.   为新页面获得一个可用的frame，若无法获得则归还页号并返回nullptr
+    Page *page = install_new_page(*page_id);
+    if (page == nullptr) {
+        disk_manager_->deallocate_page(page_id->fd, page_id->page_no);
+        page_id->page_no = INVALID_PAGE_ID;
+    }
+    return page;
+}
+
+/**
+ * @description: 为已经分配好页号的新页面获取一个frame，用于分区模式下由BufferPoolManager先分配页号再选择分区的情况
+ * @return {Page*} 返回新创建的page，若当前分区没有可用的frame则返回nullptr
+ * @param {PageId} page_id 已经由disk_manager分配好的page_id
+ */
+Page* BufferPoolInstance::new_page_at(PageId page_id) {
+    std::scoped_lock lock{latch_};
+    return install_new_page(page_id);
+}
+
+/**
+ * @description: 把新分配的页面放入缓冲池并固定，调用者需持有latch_
+ * @return {Page*} 返回新创建的page，若当前分区没有可用的frame则返回nullptr
+ * @param {PageId} page_id 新分配的page_id
+ */
+Page* BufferPoolInstance::install_new_page(PageId page_id) {
+    frame_id_t frame_id;
+    Page *page;
+    if (page_table_.find(page_id, &frame_id)) {
+        // 复用的页号在释放之后又被过期的访问读入了缓冲池，直接使用它所在的帧
+        page = get_frame(frame_id);
+        page->reset_memory();
+    } else {
+        if (!find_victim_page(&frame_id)) {
+            return nullptr;
+        }
+        // 将frame原有的数据写回磁盘
+        page = get_frame(frame_id);
+        update_page(page, page_id);
+        page_table_.insert(page_id, frame_id);
+    }
+    // 新页面在磁盘上还没有内容，标记为脏页；固定frame，更新pin_count_
+    page->is_dirty_ = true;
+    page->pin_count_++;
+    replacer_->pin(frame_id);
+    return page;
+}
+
+/**
+ * @description: 预读一批属于当前分区的页面。不在缓冲池中的页面各分配一个可用的frame，
+ *              通过disk_manager一次批量提交所有读请求，读入后不固定，直接交给replacer。预读只是提示，没有可用frame时停止。
+ *              页面读完之后才加入page table
+ * @param {vector<PageId>&} page_ids 需要预读的页面，不能有重复
+ * @param {BufferRing*} ring 非空时页面读入扫描私有的帧环
+ */
+void BufferPoolInstance::prefetch_pages(const std::vector<PageId> &page_ids, BufferRing *ring) {
+    std::scoped_lock lock{latch_};
+    std::vector<frame_id_t> frame_ids;
+    std::vector<AsyncIoRequest> requests;
+    std::vector<ssize_t> results;
+    for (auto &page_id : page_ids) {
+        frame_id_t frame_id;
+        if (page_table_.find(page_id, &frame_id)) {
+            continue;
+        }
+        if (ring != nullptr ? !find_ring_page(ring, &frame_id) : !find_victim_page(&frame_id)) {
+            break;
+        }
+        Page *page = get_frame(frame_id);
+        update_page(page, page_id);
+        // 帧在读完之前保持固定，避免被同一批中后面的页面当作可复用的帧
+        page->pin_count_++;
+        frame_ids.push_back(frame_id);
+        requests.push_back(AsyncIoRequest{page_id.fd, page_id.page_no, page->data_, PAGE_SIZE, false, nullptr});
+    }
+    results.assign(requests.size(), 0);
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].callback = [&results, i](ssize_t res) { results[i] = res; };
+    }
+    try {
+        disk_manager_->submit_and_wait(std::move(requests));
+    } catch (RMDBError &) {
+        // 部分页面读取失败（例如页面还没有写到磁盘上），下面逐个撤销
+    }
+    for (size_t i = 0; i < frame_ids.size(); i++) {
+        frame_id_t frame_id = frame_ids[i];
+        Page *page = get_frame(frame_id);
+        page->pin_count_--;
+        if (results[i] != PAGE_SIZE) {
+            page->id_.page_no = INVALID_PAGE_ID;
+            if (ring_owner_[frame_id] == nullptr) {
+                replacer_->remove(frame_id);
+                free_list_.push_back(frame_id);
+            }
+            continue;
+        }
+        page_table_.insert(page->id_, frame_id);
+        // 预读的页面没有被使用者固定，记录一次访问后即可被淘汰
+        replacer_->pin(frame_id);
+        if (ring_owner_[frame_id] == nullptr) {
+            replacer_->unpin(frame_id);
+        }
+    }
+}
+
+/**
+ * @description: 从当前分区删除目标页
+ * @return {bool} 如果目标页不存在于buffer_pool或者成功被删除则返回true，若其存在于buffer_pool但无法删除则返回false
+ * @param {PageId} page_id 目标页
+ */
+bool BufferPoolInstance::delete_page(PageId page_id) {
+    std::scoped_lock lock{latch_};
+    // 1.   在page_table_中查找目标页，若不存在返回true
+    frame_id_t frame_id;
+    if (!page_table_.find(page_id, &frame_id)) {
+        return true;
+    }
+    // 2.   若目标页的pin_count不为0，则返回false
+    Page *page = get_frame(frame_id);
+    if (page->pin_count_ != 0 || !detach_frame(frame_id)) {
+        return false;
+    }
+    // 3.   将目标页数据写回磁盘，重置其元数据，将其加入free_list_，返回true
+    update_page(page, PageId{page_id.fd, INVALID_PAGE_ID});
+    replacer_->remove(frame_id);
+    ring_owner_[frame_id] = nullptr;
+    free_list_.push_back(frame_id);
+    return true;
+}
+
+/**
+ * @description: 从当前分区删除一个即将被释放的页面。与delete_page不同，调用者持有该页面唯一的pin，
+ *              删除成功后这个pin随页面一起失效，调用者不需要也不能再unpin
+ * @return {bool} 成功删除则返回true，页面还被其他线程固定时返回false，此时调用者仍持有pin
+ * @param {PageId} page_id 目标页
+ * @param {bool} is_dirty 调用者是否修改过页面，修改过的页面先写回磁盘
+ */
+bool BufferPoolInstance::free_page(PageId page_id, bool is_dirty) {
+    std::scoped_lock lock{latch_};
+    frame_id_t frame_id;
+    if (!page_table_.find(page_id, &frame_id)) {
+        return false;
+    }
+    Page *page = get_frame(frame_id);
+    if (page->pin_count_ != 1) {
+        return false;
+    }
+    // 与detach_frame相同，先删除映射再确认没有其他线程通过无锁路径固定该帧
+    page_table_.erase(page_id);
+    if (page->pin_count_.load() != 1) {
+        page_table_.insert(page_id, frame_id);
+        return false;
+    }
+    page->pin_count_--;
+    if (is_dirty) {
+        page->is_dirty_ = true;
+    }
+    update_page(page, PageId{page_id.fd, INVALID_PAGE_ID});
+    replacer_->remove(frame_id);
+    ring_owner_[frame_id] = nullptr;
+    free_list_.push_back(frame_id);
+    return true;
+}
+
+/**
+ * @description: 固定当前分区中属于文件fd的所有脏页并清除脏页标记，由BufferPoolManager::flush_all_pages在分区的锁外写回。
+ *              固定保证写回期间页面不会被淘汰；写回之前清除标记，写回期间再次被修改的页面在unpin时重新标记为脏页
+ * @param {int} fd 文件句柄
+ * @param {vector<Page*>*} pages 追加被固定的脏页
+ */
+void BufferPoolInstance::pin_dirty_pages(int fd, std::vector<Page *> *pages) {
+    std::scoped_lock lock{latch_};
+    for (size_t c = 0; c < num_chunks_; c++) {
+        FrameChunk *chunk = chunk_storage_[c].get();
+        for (size_t i = 0; i < chunk->num_frames; i++) {
+            Page *page = &chunk->pages[i];
+            if (page->id_.fd == fd && page->id_.page_no != INVALID_PAGE_ID && page->is_dirty_) {
+                page->pin_count_++;
+                replacer_->pin(make_frame_id(c, i));
+                page->is_dirty_ = false;
+                pages->push_back(page);
+            }
+        }
+    }
+}
+
+/**
+ * @description: 写回结束后取消pin_dirty_pages对页面的固定，写回失败时重新标记为脏页
+ * @param {vector<Page*>&} pages pin_dirty_pages固定的页面
+ * @param {bool} failed 写回是否失败
+ */
+void BufferPoolInstance::unpin_flushed_pages(const std::vector<Page *> &pages, bool failed) {
+    std::scoped_lock lock{latch_};
+    for (Page *page : pages) {
+        if (failed) {
+            page->is_dirty_ = true;
+        }
+        // 页面被固定，映射在写回期间不会改变
+        frame_id_t frame_id = INVALID_FRAME_ID;
+        page_table_.find(page->id_, &frame_id);
+        if (--page->pin_count_ == 0) {
+            release_frame(frame_id);
+        }
+    }
+}
+
+/**
+ * @description: 扫描结束时归还帧环中的帧，未被固定的帧交给replacer，仍被固定的帧在unpin时交给replacer
+ * @param {BufferRing*} ring 要归还的帧环
+ */
+void BufferPoolInstance::release_ring(BufferRing *ring) {
+    std::scoped_lock lock{latch_};
+    for (frame_id_t frame_id : ring->frames) {
+        if (ring_owner_[frame_id] != ring) {
+            continue;
+        }
+        ring_owner_[frame_id] = nullptr;
+        if (get_frame(frame_id)->pin_count_ == 0 && get_frame(frame_id)->id_.page_no != INVALID_PAGE_ID) {
+            release_frame(frame_id);
+        }
+    }
+    ring->frames.clear();
+    ring->next = 0;
+}
+
+/**
+ * @description: 由后台刷脏线程调用。replacer中接下来会被淘汰的clean_ratio * pool_size个帧
+ *              (空闲帧也计入其中)应当保持干净，把其中的脏页提前批量写回磁盘，
+ *              使前台线程淘汰页面时不需要同步写盘。为了遵守WAL，页面LSN大于persisted_lsn的脏页不写回。
+ *              选中的页面被固定，写回期间不会被淘汰；并持有页面的读锁，写回的不会是修改到一半的页面，
+ *              读锁被占用(页面正在被修改)的页面跳过。写盘期间不持有latch_，不阻塞当前分区的其他操作
+ * @return {size_t} 写回的页面个数
+ * @param {double} clean_ratio 应当保持干净的帧占当前分区帧数的比例
+ * @param {size_t} max_pages 本次最多写回的页面个数
+ * @param {lsn_t} persisted_lsn 已经持久化的最大日志号
+ */
+size_t BufferPoolInstance::flush_eviction_candidates(double clean_ratio, size_t max_pages, lsn_t persisted_lsn) {
+    std::vector<frame_id_t> frame_ids;
+    std::vector<AsyncIoRequest> requests;
+    {
+        std::scoped_lock lock{latch_};
+        size_t target = static_cast<size_t>(clean_ratio * pool_size_);
+        if (target <= free_list_.size() || max_pages == 0) {
+            return 0;
+        }
+        for (frame_id_t frame_id : replacer_->eviction_candidates(target - free_list_.size())) {
+            Page *page = get_frame(frame_id);
+            // 正在被使用的页面很可能马上又被修改，留到下一轮
+            if (!page->is_dirty_ || page->pin_count_ != 0) {
+                continue;
+            }
+            page->pin_count_++;
+            if (!page->latch_->try_lock_shared()) {
+                if (--page->pin_count_ == 0) {
+                    release_frame(frame_id);
+                }
+                continue;
+            }
+            if (page->get_page_lsn() > persisted_lsn) {
+                page->latch_->unlock_shared();
+                if (--page->pin_count_ == 0) {
+                    release_frame(frame_id);
+                }
+                continue;
+            }
+            // 持有读锁期间页面不会被修改，写回之前清除标记即可
+            page->is_dirty_ = false;
+            frame_ids.push_back(frame_id);
+            requests.push_back(AsyncIoRequest{page->id_.fd, page->id_.page_no, page->data_, PAGE_SIZE, true, nullptr});
+            if (frame_ids.size() == max_pages) {
+                break;
+            }
+        }
+    }
+    std::vector<ssize_t> results(requests.size(), 0);
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].callback = [&results, i](ssize_t res) { results[i] = res; };
+    }
+    try {
+        disk_manager_->submit_and_wait(std::move(requests));
+    } catch (RMDBError &) {
+        // 写失败的页面保持为脏页，淘汰时再同步写回
+    }
+    std::scoped_lock lock{latch_};
+    size_t flushed = 0;
+    for (size_t i = 0; i < frame_ids.size(); i++) {
+        Page *page = get_frame(frame_ids[i]);
+        page->latch_->unlock_shared();
+        if (results[i] == PAGE_SIZE) {
+            disk_manager_->record_event(page->id_.fd, FLUSHED_PAGES);
+            flushed++;
+        } else {
+            page->is_dirty_ = true;
+        }
+        if (--page->pin_count_ == 0) {
+            release_frame(frame_ids[i]);
+        }
+    }
+    return flushed;
+}
+
+/**
+ * @description: 按照最近被访问的先后顺序列出当前分区中的页面，用于重启后预热缓冲池。
+ *              正在被固定的页面排在最前面，其余页面按replacer的淘汰顺序倒序排列；帧环中的页面属于大表扫描，不列出
+ * @return {vector<PageId>} 当前分区中的页面，最近被访问的在前
+ */
+std::vector<PageId> BufferPoolInstance::get_resident_pages() {
+    std::scoped_lock lock{latch_};
+    std::vector<PageId> page_ids;
+    for (size_t c = 0; c < num_chunks_; c++) {
+        FrameChunk *chunk = chunk_storage_[c].get();
+        for (size_t i = 0; i < chunk->num_frames; i++) {
+            Page *page = &chunk->pages[i];
+            if (page->pin_count_ > 0 && ring_owner_[make_frame_id(c, i)] == nullptr &&
+                page->id_.page_no != INVALID_PAGE_ID) {
+                page_ids.push_back(page->id_);
+            }
+        }
+    }
+    // 命中时被固定的帧仍在replacer中，已经在上面列出
+    std::vector<frame_id_t> candidates = replacer_->eviction_candidates(pool_size_);
+    for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+        if (get_frame(*it)->pin_count_ == 0) {
+            page_ids.push_back(get_frame(*it)->id_);
+        }
+    }
+    return page_ids;
+}
+
+/**
+ * @description: 在分区末尾增加一个chunk，新的帧全部加入free_list_。优先复用之前被回收的chunk，调用者需持有latch_
+ * @return {bool} 成功则返回true，chunk个数已经达到BUFFER_POOL_MAX_CHUNKS时返回false
+ * @param {size_t} max_frames 新分配的chunk最多包含的帧数，不超过chunk_frames_
+ */
+bool BufferPoolInstance::add_chunk(size_t max_frames) {
+    if (num_chunks_ >= static_cast<size_t>(BUFFER_POOL_MAX_CHUNKS)) {
+        return false;
+    }
+    size_t chunk_idx = num_chunks_;
+    FrameChunk *chunk;
+    if (chunk_idx < chunk_storage_.size()) {
+        chunk = chunk_storage_[chunk_idx].get();
+        chunk->attach_arena();
+    } else {
+        chunk_storage_.push_back(std::make_unique<FrameChunk>(std::min(max_frames, chunk_frames_)));
+        chunk = chunk_storage_.back().get();
+        chunks_[chunk_idx].store(chunk, std::memory_order_release);
+    }
+    size_t max_frame_id = static_cast<size_t>(make_frame_id(chunk_idx, 0)) + chunk->num_frames;
+    replacer_->resize(max_frame_id);
+    if (ring_owner_.size() < max_frame_id) {
+        ring_owner_.resize(max_frame_id, nullptr);
+    }
+    pool_size_ += chunk->num_frames;
+    page_table_.reserve(pool_size_);
+    for (size_t i = 0; i < chunk->num_frames; i++) {
+        free_list_.push_back(make_frame_id(chunk_idx, i));
+    }
+    num_chunks_++;
+    return true;
+}
+
+/**
+ * @description: 回收分区末尾的chunk：淘汰其中所有的页面，脏页写回磁盘，然后释放数据区。调用者需持有latch_。
+ *              chunk中有页面被固定时不做任何修改，返回false
+ * @return {bool} 成功回收则返回true
+ */
+bool BufferPoolInstance::retire_last_chunk() {
+    if (num_chunks_ <= 1) {
+        return false;
+    }
+    size_t chunk_idx = num_chunks_ - 1;
+    FrameChunk *chunk = chunk_storage_[chunk_idx].get();
+    // 1. 把所有页面从页表中移除，有页面被固定时恢复已经移除的映射
+    std::vector<frame_id_t> detached;
+    for (size_t i = 0; i < chunk->num_frames; i++) {
+        frame_id_t frame_id = make_frame_id(chunk_idx, i);
+        Page *page = &chunk->pages[i];
+        if (page->id_.page_no == INVALID_PAGE_ID) {
+            continue;
+        }
+        if (page->pin_count_ != 0 || !detach_frame(frame_id)) {
+            for (frame_id_t id : detached) {
+                page_table_.insert(get_frame(id)->id_, id);
+            }
+            return false;
+        }
+        detached.push_back(frame_id);
+    }
+    // 2. 写回脏页，把帧从replacer、帧环和free_list_中移除
+    for (frame_id_t frame_id : detached) {
+        Page *page = get_frame(frame_id);
+        update_page(page, PageId{page->id_.fd, INVALID_PAGE_ID});
+        replacer_->remove(frame_id);
+    }
+    frame_id_t first = make_frame_id(chunk_idx, 0);
+    frame_id_t last = first + static_cast<frame_id_t>(chunk->num_frames);
+    for (frame_id_t frame_id = first; frame_id < last; frame_id++) {
+        ring_owner_[frame_id] = nullptr;
+    }
+    free_list_.remove_if([first, last](frame_id_t frame_id) { return frame_id >= first && frame_id < last; });
+    // 3. 释放数据区，描述符保留给可能持有过期帧编号的无锁路径
+    chunk->release_arena();
+    pool_size_ -= chunk->num_frames;
+    num_chunks_--;
+    return true;
+}
+
+/**
+ * @description: 调整分区的大小。扩容时在末尾增加chunk；缩容时从末尾开始回收chunk，
+ *              chunk中有页面被固定时等待一段时间后重试，仍然失败则停止缩容。分区至少保留一个chunk
+ * @return {size_t} 调整之后分区的帧数，以chunk为单位，扩容后不小于pool_size，缩容后不小于pool_size
+ * @param {size_t} pool_size 目标帧数
+ */
+size_t BufferPoolInstance::resize(size_t pool_size) {
+    std::unique_lock lock{latch_};
+    while (pool_size_ < pool_size && add_chunk(chunk_frames_)) {
+    }
+    int retries = 0;
+    while (num_chunks_ > 1 && pool_size_ - chunk_storage_[num_chunks_ - 1]->num_frames >= pool_size) {
+        if (retire_last_chunk()) {
+            retries = 0;
+            continue;
+        }
+        if (++retries > BUFFER_POOL_RESIZE_RETRIES) {
+            break;
+        }
+        // 等待使用者unpin，期间不阻塞当前分区的其他操作
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        lock.lock();
+    }
+    return pool_size_;
+}
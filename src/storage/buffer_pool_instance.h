@@ -0,0 +1,172 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "buffer_access_strategy.h"
+#include "disk_manager.h"
+#include "errors.h"
+#include "page.h"
+#include "page_arena.h"
+#include "page_table.h"
+#include "replacer/clock_replacer.h"
+#include "replacer/lru_k_replacer.h"
+#include "replacer/lru_replacer.h"
+#include "replacer/replacer.h"
+
+/**
+ * @description: 缓冲池分区中的一组连续编号的帧：帧描述符、每个帧的读写锁和页面数据区。
+ * 分区的帧由若干个chunk组成，扩容时增加chunk，缩容时淘汰末尾chunk中的所有页面后释放其数据区。
+ * 描述符和读写锁在分区析构之前不会释放，无锁路径即使持有过期的帧编号，固定和撤销固定也不会访问已经释放的内存；
+ * 被回收的chunk在再次扩容时重新分配数据区并复用
+ */
+struct FrameChunk {
+    size_t num_frames;                                  // chunk中帧的个数
+    std::unique_ptr<PageArena> arena;                   // 页面数据区，chunk被回收时释放
+    std::unique_ptr<Page[]> pages;                      // 帧描述符，紧凑排列，第i个描述符的数据位于arena的第i页
+    std::unique_ptr<std::shared_mutex[]> latches;       // 每个帧的读写锁，第i个锁属于第i个帧
+
+    explicit FrameChunk(size_t num_frames) : num_frames(num_frames) {
+        pages = std::make_unique<Page[]>(num_frames);
+        latches = std::make_unique<std::shared_mutex[]>(num_frames);
+        for (size_t i = 0; i < num_frames; ++i) {
+            pages[i].latch_ = &latches[i];
+        }
+        attach_arena();
+    }
+
+    void attach_arena() {
+        arena = std::make_unique<PageArena>(num_frames, BUFFER_POOL_HUGE_PAGES);
+        for (size_t i = 0; i < num_frames; ++i) {
+            pages[i].data_ = arena->get_page(i);
+        }
+    }
+
+    void release_arena() {
+        for (size_t i = 0; i < num_frames; ++i) {
+            pages[i].data_ = nullptr;
+        }
+        arena.reset();
+    }
+};
+
+/**
+ * @description: 缓冲池的一个分区，拥有自己的帧、页表、空闲链表、替换器和互斥锁。
+ * BufferPoolManager根据PageId的哈希值把页面分配到不同的分区，不同分区之间的操作互不阻塞。
+ * 帧编号的高位是chunk下标，低位是帧在chunk中的下标，扩容和缩容不会改变已有帧的编号
+ */
+class BufferPoolInstance {
+   private:
+    std::atomic<size_t> pool_size_;     // 当前分区中可容纳页面的个数，即所有在用chunk中帧的个数之和
+    size_t chunk_frames_;   // 每个chunk的帧数
+    size_t chunk_shift_;    // 帧编号中chunk下标的偏移，1 << chunk_shift_不小于chunk_frames_
+    std::unique_ptr<std::atomic<FrameChunk *>[]> chunks_;   // 以chunk下标为下标的chunk指针，无锁路径通过它定位帧描述符
+    std::vector<std::unique_ptr<FrameChunk>> chunk_storage_;   // 分配过的所有chunk，包括已经回收的
+    size_t num_chunks_ = 0;     // 在用的chunk个数，在用的chunk总是chunk_storage_的前num_chunks_个
+    PageTable page_table_;  // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号，查找不需要latch_
+    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+    std::vector<BufferRing *> ring_owner_;  // 每个帧所属的BufferRing，不属于任何环时为nullptr
+    DiskManager *disk_manager_;
+    Replacer *replacer_;    // 当前分区的置换策略
+    std::mutex latch_;      // 用于当前分区共享数据结构的并发控制，命中缓冲池的fetch_page不需要获取
+
+   public:
+    BufferPoolInstance(size_t pool_size, DiskManager *disk_manager)
+        : pool_size_(0),
+          chunk_frames_(std::min<size_t>(std::max<size_t>(pool_size, 1), BUFFER_POOL_CHUNK_SIZE)),
+          chunk_shift_(0),
+          chunks_(std::make_unique<std::atomic<FrameChunk *>[]>(BUFFER_POOL_MAX_CHUNKS)),
+          page_table_(pool_size),
+          disk_manager_(disk_manager) {
+        while ((static_cast<size_t>(1) << chunk_shift_) < chunk_frames_) {
+            chunk_shift_++;
+        }
+        // 可以被Replacer改变，容量在扩容时增大
+        if (REPLACER_TYPE == "CLOCK")
+            replacer_ = new ClockReplacer(0);
+        else if (REPLACER_TYPE == "LRU-K")
+            replacer_ = new LRUKReplacer(0, LRU_K_REPLACER_K);
+        else {
+            replacer_ = new LRUReplacer(0);
+        }
+        // 帧描述符与页面数据分开存放，扫描描述符时不会访问页面数据；初始化时，所有的帧都在free_list_中
+        while (pool_size_ < pool_size && add_chunk(pool_size - pool_size_)) {
+        }
+    }
+
+    ~BufferPoolInstance() { delete replacer_; }
+
+    size_t get_pool_size() const { return pool_size_; }
+
+    size_t get_chunk_frames() const { return chunk_frames_; }
+
+    size_t resize(size_t pool_size);
+
+    Page* fetch_page(PageId page_id, BufferRing *ring = nullptr);
+
+    bool unpin_page(PageId page_id, bool is_dirty);
+
+    bool flush_page(PageId page_id);
+
+    Page* new_page(PageId* page_id);
+
+    Page* new_page_at(PageId page_id);
+
+    bool delete_page(PageId page_id);
+
+    bool free_page(PageId page_id, bool is_dirty);
+
+    void pin_dirty_pages(int fd, std::vector<Page *> *pages);
+
+    void unpin_flushed_pages(const std::vector<Page *> &pages, bool failed);
+
+    void prefetch_pages(const std::vector<PageId> &page_ids, BufferRing *ring = nullptr);
+
+    void release_ring(BufferRing *ring);
+
+    size_t flush_eviction_candidates(double clean_ratio, size_t max_pages, lsn_t persisted_lsn);
+
+    std::vector<PageId> get_resident_pages();
+
+   private:
+    bool find_victim_page(frame_id_t* frame_id);
+
+    bool find_ring_page(BufferRing *ring, frame_id_t* frame_id);
+
+    bool detach_frame(frame_id_t frame_id);
+
+    void release_frame(frame_id_t frame_id);
+
+    Page* install_new_page(PageId page_id);
+
+    bool add_chunk(size_t max_frames);
+
+    bool retire_last_chunk();
+
+    /** @return 帧编号对应的帧描述符，不需要持有latch_ */
+    Page* get_frame(frame_id_t frame_id) const {
+        FrameChunk *chunk = chunks_[static_cast<size_t>(frame_id) >> chunk_shift_].load(std::memory_order_acquire);
+        return &chunk->pages[static_cast<size_t>(frame_id) & ((static_cast<size_t>(1) << chunk_shift_) - 1)];
+    }
+
+    frame_id_t make_frame_id(size_t chunk_idx, size_t idx) const {
+        return static_cast<frame_id_t>((chunk_idx << chunk_shift_) | idx);
+    }
+
+    void update_page(Page* page, PageId new_page_id);
+};
@@ -10,51 +10,95 @@ See the Mulan PSL v2 for more details. */
 
 #include "buffer_pool_manager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+BufferAccessStrategy::BufferAccessStrategy(BufferPoolManager *buffer_pool_manager, size_t ring_size)
+    : buffer_pool_manager_(buffer_pool_manager), rings_(buffer_pool_manager->get_num_instances()) {
+    size_t per_instance = std::max<size_t>(1, ring_size / rings_.size());
+    for (auto &ring : rings_) {
+        ring.capacity = per_instance;
+    }
+}
+
+BufferAccessStrategy::~BufferAccessStrategy() { buffer_pool_manager_->release_strategy(this); }
+
 /**
- * @description: 从free_list或replacer中得到可淘汰帧页的 *frame_id
- * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
- * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
+ * @description: 根据PageId选择页面所在的缓冲池分区，同一个页面总是映射到同一个分区
+ * @return {size_t} 页面所属分区的下标
+ * @param {PageId} page_id 目标页的PageId
  */
-bool BufferPoolManager::find_victim_page(frame_id_t* frame_id) {
-    // Todo:
-    // 1 使用BufferPoolManager::free_list_判断缓冲池是否已满需要淘汰页面
-    // 1.1 未满获得frame
-    // 1.2 已满使用lru_replacer中的方法选择淘汰页面
+size_t BufferPoolManager::get_instance_index(PageId page_id) {
+    if (instances_.size() == 1) {
+        return 0;
+    }
+    // 将fd与page_no混合，使同一文件中的连续页面分散到不同分区
+    uint64_t h = static_cast<uint64_t>(page_id.fd) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<uint64_t>(static_cast<uint32_t>(page_id.page_no));
+    h ^= h >> 29;
+    return h % instances_.size();
+}
 
-    return false;
+BufferPoolInstance* BufferPoolManager::get_instance(PageId page_id) {
+    return instances_[get_instance_index(page_id)].get();
 }
 
 /**
- * @description: 更新页面数据, 如果为脏页则需写入磁盘，再更新为新页面，更新page元数据(data, is_dirty, page_id)和page table
- * @param {Page*} page 写回页指针
- * @param {PageId} new_page_id 新的page_id
- * @param {frame_id_t} new_frame_id 新的帧frame_id
+ * @description: 从buffer pool获取需要的页，由页面所属的分区完成查找和替换
+ * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
+ * @param {PageId} page_id 需要获取的页的PageId
+ * @param {BufferAccessStrategy*} strategy 访问策略，非空时未命中的页面读入策略私有的帧环
  */
-void BufferPoolManager::update_page(Page *page, PageId new_page_id, frame_id_t new_frame_id) {
-    // Todo:
-    // 1 如果是脏页，写回磁盘，并且把dirty置为false
-    // 2 更新page table
-    // 3 重置page的data，更新page id
+Page* BufferPoolManager::fetch_page(PageId page_id, BufferAccessStrategy *strategy) {
+    size_t idx = get_instance_index(page_id);
+    return instances_[idx]->fetch_page(page_id, strategy == nullptr ? nullptr : &strategy->rings_[idx]);
+}
 
+/**
+ * @description: 获取并固定目标页，再获取页面的读锁。同一页面的多个读者可以并发访问
+ * @return {ReadPageGuard} 持有读锁的页面，析构时自动释放读锁并unpin；获取失败时is_valid()为false
+ * @param {PageId} page_id 需要获取的页的PageId
+ * @param {BufferAccessStrategy*} strategy 访问策略，非空时未命中的页面读入策略私有的帧环
+ */
+ReadPageGuard BufferPoolManager::fetch_page_read(PageId page_id, BufferAccessStrategy *strategy) {
+    Page *page = fetch_page(page_id, strategy);
+    if (page == nullptr) {
+        return ReadPageGuard();
+    }
+    page->RLatch();
+    return ReadPageGuard(this, page);
 }
 
 /**
- * @description: 从buffer pool获取需要的页。
- *              如果页表中存在page_id（说明该page在缓冲池中），并且pin_count++。
- *              如果页表不存在page_id（说明该page在磁盘中），则找缓冲池victim page，将其替换为磁盘中读取的page，pin_count置1。
- * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
+ * @description: 获取并固定目标页，再获取页面的写锁
+ * @return {WritePageGuard} 持有写锁的页面，析构时自动释放写锁并unpin；获取失败时is_valid()为false
+ * @param {PageId} page_id 需要获取的页的PageId
+ */
+WritePageGuard BufferPoolManager::fetch_page_write(PageId page_id) {
+    Page *page = fetch_page(page_id);
+    if (page == nullptr) {
+        return WritePageGuard();
+    }
+    page->WLatch();
+    return WritePageGuard(this, page);
+}
+
+/**
+ * @description: 获取并固定目标页，只尝试获取页面的写锁，不等待。已经持有其他页面写锁的线程用它避免按相反顺序加锁造成死锁
+ * @return {WritePageGuard} 持有写锁的页面；获取失败或写锁被其他线程持有时is_valid()为false
  * @param {PageId} page_id 需要获取的页的PageId
  */
-Page* BufferPoolManager::fetch_page(PageId page_id) {
-    //Todo:
-    // 1.     从page_table_中搜寻目标页
-    // 1.1    若目标页有被page_table_记录，则将其所在frame固定(pin)，并返回目标页。
-    // 1.2    否则，尝试调用find_victim_page获得一个可用的frame，若失败则返回nullptr
-    // 2.     若获得的可用frame存储的为dirty page，则须调用updata_page将page写回到磁盘
-    // 3.     调用disk_manager_的read_page读取目标页到frame
-    // 4.     固定目标页，更新pin_count_
-    // 5.     返回目标页
-    return nullptr;
+WritePageGuard BufferPoolManager::try_fetch_page_write(PageId page_id) {
+    Page *page = fetch_page(page_id);
+    if (page == nullptr) {
+        return WritePageGuard();
+    }
+    if (!page->latch_->try_lock()) {
+        unpin_page(page_id, false);
+        return WritePageGuard();
+    }
+    return WritePageGuard(this, page);
 }
 
 /**
@@ -64,16 +108,7 @@ Page* BufferPoolManager::fetch_page(PageId page_id) {
  * @param {bool} is_dirty 若目标page应该被标记为dirty则为true，否则为false
  */
 bool BufferPoolManager::unpin_page(PageId page_id, bool is_dirty) {
-    // Todo:
-    // 0. lock latch
-    // 1. 尝试在page_table_中搜寻page_id对应的页P
-    // 1.1 P在页表中不存在 return false
-    // 1.2 P在页表中存在，获取其pin_count_
-    // 2.1 若pin_count_已经等于0，则返回false
-    // 2.2 若pin_count_大于0，则pin_count_自减一
-    // 2.2.1 若自减后等于0，则调用replacer_的Unpin
-    // 3 根据参数is_dirty，更改P的is_dirty_
-    return true;
+    return get_instance(page_id)->unpin_page(page_id, is_dirty);
 }
 
 /**
@@ -82,28 +117,27 @@ bool BufferPoolManager::unpin_page(PageId page_id, bool is_dirty) {
  * @param {PageId} page_id 目标页的page_id，不能为INVALID_PAGE_ID
  */
 bool BufferPoolManager::flush_page(PageId page_id) {
-    // Todo:
-    // 0. lock latch
-    // 1. 查找页表,尝试获取目标页P
-    // 1.1 目标页P没有被page_table_记录 ，返回false
-    // 2. 无论P是否为脏都将其写回磁盘。
-    // 3. 更新P的is_dirty_
-   
-    return true;
+    return get_instance(page_id)->flush_page(page_id);
 }
 
 /**
  * @description: 创建一个新的page，即从磁盘中移动一个新建的空page到缓冲池某个位置。
+ *              只有一个分区时先获取帧再分配页号；有多个分区时需要先分配页号才能确定分区，
+ *              若该分区没有可用的帧则归还页号并返回nullptr
  * @return {Page*} 返回新创建的page，若创建失败则返回nullptr
  * @param {PageId*} page_id 当成功创建一个新的page时存储其page_id
  */
 Page* BufferPoolManager::new_page(PageId* page_id) {
-    // 1.   获得一个可用的frame，若无法获得则返回nullptr
-    // 2.   在fd对应的文件分配一个新的page_id
-    // 3.   将frame的数据写回磁盘
-    // 4.   固定frame，更新pin_count_
-    // 5.   返回获得的page
-   return nullptr;
+    if (instances_.size() == 1) {
+        return instances_[0]->new_page(page_id);
+    }
+    page_id->page_no = disk_manager_->allocate_page(page_id->fd);
+    Page *page = get_instance(*page_id)->new_page_at(*page_id);
+    if (page == nullptr) {
+        disk_manager_->deallocate_page(page_id->fd, page_id->page_no);
+        page_id->page_no = INVALID_PAGE_ID;
+    }
+    return page;
 }
 
 /**
@@ -112,17 +146,271 @@ Page* BufferPoolManager::new_page(PageId* page_id) {
  * @param {PageId} page_id 目标页
  */
 bool BufferPoolManager::delete_page(PageId page_id) {
-    // 1.   在page_table_中查找目标页，若不存在返回true
-    // 2.   若目标页的pin_count不为0，则返回false
-    // 3.   将目标页数据写回磁盘，从页表中删除目标页，重置其元数据，将其加入free_list_，返回true
-    
+    return get_instance(page_id)->delete_page(page_id);
+}
+
+/**
+ * @description: 释放一个不再使用的页面：从buffer_pool删除该页面(脏页先写回磁盘)，再把页号归还给disk_manager，
+ *              之后new_page会优先复用这个页号。调用者持有该页面唯一的pin，释放成功后不需要再unpin
+ * @return {bool} 成功释放则返回true；页面还被其他线程固定时返回false，此时页面没有被释放，调用者仍持有pin
+ * @param {PageId} page_id 要释放的页面
+ */
+bool BufferPoolManager::free_page(PageId page_id) {
+    if (!get_instance(page_id)->free_page(page_id, false)) {
+        return false;
+    }
+    disk_manager_->deallocate_page(page_id.fd, page_id.page_no);
+    return true;
+}
+
+/**
+ * @description: 释放写守卫持有的页面。成功时守卫不再持有页面；失败时守卫保持不变
+ * @return {bool} 成功释放则返回true；页面还被其他线程固定时返回false
+ * @param {WritePageGuard&} guard 持有目标页写锁的守卫
+ */
+bool BufferPoolManager::free_page(WritePageGuard &guard) {
+    Page *page = guard.page_;
+    PageId page_id = page->get_page_id();
+    if (!get_instance(page_id)->free_page(page_id, guard.is_dirty_)) {
+        return false;
+    }
+    // 页面已经不在页表中，其他线程只能在帧被重新使用之后再获取这个锁
+    page->WUnlatch();
+    guard.page_ = nullptr;
+    guard.buffer_pool_manager_ = nullptr;
+    guard.is_dirty_ = false;
+    disk_manager_->deallocate_page(page_id.fd, page_id.page_no);
     return true;
 }
 
 /**
- * @description: 将buffer_pool中的所有页写回到磁盘
+ * @description: 将buffer_pool中属于文件fd的所有脏页写回到磁盘。
+ *              各个分区的脏页按page_no排序，页号相邻的页面合并为一个pwritev请求(最多FLUSH_MAX_RUN_PAGES个页面)，
+ *              每批请求一次提交，顺序写代替按帧顺序的随机写。写回期间页面保持固定，不持有分区的锁。
+ *              每批最多FLUSH_BATCH_PAGES个页面，先逐个在页面的读锁下复制到对齐的暂存区，写回的总是某次修改完成之后的页面，
+ *              写盘期间也不阻塞修改页面的线程；同一时刻只持有一个页面的读锁，不会与按其他顺序加锁的线程死锁。
+ *              调用者不能持有该文件中任何页面的写锁
+ * @return {FlushStats} 写回的页面数、字节数和写请求数
+ * @param {int} fd 文件句柄
+ */
+FlushStats BufferPoolManager::flush_all_pages(int fd) {
+    std::vector<std::vector<Page *>> pinned(instances_.size());
+    std::vector<Page *> dirty_pages;
+    for (size_t idx = 0; idx < instances_.size(); idx++) {
+        instances_[idx]->pin_dirty_pages(fd, &pinned[idx]);
+        dirty_pages.insert(dirty_pages.end(), pinned[idx].begin(), pinned[idx].end());
+    }
+    std::sort(dirty_pages.begin(), dirty_pages.end(),
+              [](const Page *a, const Page *b) { return a->id_.page_no < b->id_.page_no; });
+
+    FlushStats stats;
+    bool failed = false;
+    size_t batch_pages = std::min(dirty_pages.size(), static_cast<size_t>(FLUSH_BATCH_PAGES));
+    std::unique_ptr<PageArena> staging = batch_pages == 0 ? nullptr : std::make_unique<PageArena>(batch_pages, false);
+    for (size_t start = 0; start < dirty_pages.size() && !failed; start += batch_pages) {
+        size_t end = std::min(start + batch_pages, dirty_pages.size());
+        for (size_t i = start; i < end; i++) {
+            dirty_pages[i]->RLatch();
+            memcpy(staging->get_page(i - start), dirty_pages[i]->data_, PAGE_SIZE);
+            dirty_pages[i]->RUnlatch();
+        }
+        std::vector<AsyncIoRequest> requests;
+        for (size_t i = start; i < end;) {
+            AsyncIoRequest req{fd, dirty_pages[i]->id_.page_no, nullptr, 0, true, nullptr};
+            do {
+                req.bufs.push_back(staging->get_page(i - start));
+                i++;
+            } while (i < end && req.bufs.size() < static_cast<size_t>(FLUSH_MAX_RUN_PAGES) &&
+                     dirty_pages[i]->id_.page_no == req.page_no + static_cast<page_id_t>(req.bufs.size()));
+            req.num_bytes = static_cast<int>(req.bufs.size()) * PAGE_SIZE;
+            stats.num_pages += req.bufs.size();
+            stats.num_bytes += req.num_bytes;
+            stats.num_writes++;
+            requests.push_back(std::move(req));
+        }
+        try {
+            disk_manager_->submit_and_wait(std::move(requests));
+        } catch (RMDBError &) {
+            failed = true;
+        }
+    }
+    for (size_t idx = 0; idx < instances_.size(); idx++) {
+        instances_[idx]->unpin_flushed_pages(pinned[idx], failed);
+    }
+    if (failed) {
+        throw InternalError("BufferPoolManager::flush_all_pages Error");
+    }
+    disk_manager_->record_event(fd, FLUSHED_PAGES, stats.num_pages);
+    return stats;
+}
+
+/**
+ * @description: 异步预读文件fd中从first开始的count个连续页面，页面读入后不被固定。预读只是提示，失败时直接忽略
+ * @param {int} fd 文件句柄
+ * @param {page_id_t} first 第一个预读的页面号
+ * @param {int} count 预读的页面个数
+ * @param {shared_ptr<BufferAccessStrategy>} strategy 非空时页面读入扫描私有的帧环
+ */
+void BufferPoolManager::prefetch_pages(int fd, page_id_t first, int count,
+                                       std::shared_ptr<BufferAccessStrategy> strategy) {
+    if (count <= 0) {
+        return;
+    }
+    io_workers_->submit([this, fd, first, count, strategy]() {
+        // 按分区分组，每个分区的页面一次批量读入
+        std::vector<std::vector<PageId>> groups(instances_.size());
+        for (page_id_t page_no = first; page_no < first + count; page_no++) {
+            PageId page_id{fd, page_no};
+            groups[get_instance_index(page_id)].push_back(page_id);
+        }
+        for (size_t idx = 0; idx < instances_.size(); idx++) {
+            if (!groups[idx].empty()) {
+                instances_[idx]->prefetch_pages(groups[idx], strategy == nullptr ? nullptr : &strategy->rings_[idx]);
+            }
+        }
+    });
+}
+
+/**
+ * @description: 异步预读一条页面链，例如B+树通过next_leaf相连的叶子结点。
+ *              工作线程依次读入页面，持有页面的读锁调用next_page从页面内容中得到下一个页面号，返回负数时停止。
+ *              读锁保证不会读到分裂或合并修改到一半的链接
  * @param {int} fd 文件句柄
+ * @param {page_id_t} first 链上第一个预读的页面号
+ * @param {int} count 最多预读的页面个数
+ * @param {function<page_id_t(Page*)>} next_page 根据当前页面内容返回下一个页面号
+ */
+void BufferPoolManager::prefetch_chain(int fd, page_id_t first, int count,
+                                       std::function<page_id_t(Page *)> next_page) {
+    if (count <= 0 || first < 0) {
+        return;
+    }
+    io_workers_->submit([this, fd, first, count, next_page = std::move(next_page)]() {
+        page_id_t page_no = first;
+        for (int i = 0; i < count && page_no >= 0; i++) {
+            ReadPageGuard guard;
+            try {
+                guard = fetch_page_read(PageId{fd, page_no});
+            } catch (RMDBError &) {
+                return;
+            }
+            if (!guard.is_valid()) {
+                return;
+            }
+            page_no = next_page(guard.get_page());
+        }
+    });
+}
+
+/**
+ * @description: 归还访问策略在各个分区中占用的帧，由BufferAccessStrategy的析构函数调用
+ * @param {BufferAccessStrategy*} strategy 要归还的访问策略
+ */
+void BufferPoolManager::release_strategy(BufferAccessStrategy *strategy) {
+    for (size_t i = 0; i < instances_.size(); i++) {
+        instances_[i]->release_ring(&strategy->rings_[i]);
+    }
+}
+
+/**
+ * @description: 启动后台刷脏线程。线程每隔BG_FLUSH_INTERVAL_MS执行一轮bg_flush_round，
+ *              提前写回replacer尾部的脏页，使前台线程淘汰页面时不需要同步写盘
+ * @param {function<lsn_t()>} persisted_lsn 返回已经持久化的最大日志号，LSN更大的脏页不会被写回；为空时不检查WAL
+ */
+void BufferPoolManager::start_background_flusher(std::function<lsn_t()> persisted_lsn) {
+    if (flusher_.joinable()) {
+        return;
+    }
+    persisted_lsn_ = std::move(persisted_lsn);
+    flusher_stop_ = false;
+    flusher_ = std::thread([this]() {
+        std::unique_lock lock{flusher_latch_};
+        while (!flusher_cv_.wait_for(lock, std::chrono::milliseconds(BG_FLUSH_INTERVAL_MS),
+                                     [this] { return flusher_stop_; })) {
+            lock.unlock();
+            bg_flush_round();
+            lock.lock();
+        }
+    });
+}
+
+/**
+ * @description: 停止后台刷脏线程，正在执行的一轮刷脏完成后返回
+ */
+void BufferPoolManager::stop_background_flusher() {
+    if (!flusher_.joinable()) {
+        return;
+    }
+    {
+        std::scoped_lock lock{flusher_latch_};
+        flusher_stop_ = true;
+    }
+    flusher_cv_.notify_all();
+    flusher_.join();
+}
+
+/**
+ * @description: 执行一轮后台刷脏。本轮最多写回bg_flush_rate * BG_FLUSH_INTERVAL_MS / 1000个页面，依次分配给各个分区
+ * @return {size_t} 本轮写回的页面个数
+ */
+size_t BufferPoolManager::bg_flush_round() {
+    size_t rate = bg_flush_rate_;
+    if (rate == 0) {
+        return 0;
+    }
+    size_t budget = std::max<size_t>(1, rate * BG_FLUSH_INTERVAL_MS / 1000);
+    lsn_t persisted_lsn = persisted_lsn_ ? persisted_lsn_() : std::numeric_limits<lsn_t>::max();
+    double clean_ratio = bg_clean_ratio_;
+    size_t flushed = 0;
+    // 每轮从不同的分区开始，避免预算总是被前面的分区用完
+    size_t start = bg_flush_next_instance_++ % instances_.size();
+    for (size_t i = 0; i < instances_.size() && flushed < budget; i++) {
+        auto &instance = instances_[(start + i) % instances_.size()];
+        flushed += instance->flush_eviction_candidates(clean_ratio, budget - flushed, persisted_lsn);
+    }
+    bg_flushed_pages_ += flushed;
+    return flushed;
+}
+
+/**
+ * @description: 列出缓冲池中的页面，用于重启后预热缓冲池。
+ *              各分区内的页面按最近被访问的先后排列，分区之间轮流取出，使列表的前缀近似为全局最近被访问的页面
+ * @return {vector<PageId>} 缓冲池中的页面，最近被访问的在前
+ */
+std::vector<PageId> BufferPoolManager::get_resident_pages() {
+    std::vector<std::vector<PageId>> lists;
+    size_t longest = 0;
+    for (auto &instance : instances_) {
+        lists.push_back(instance->get_resident_pages());
+        longest = std::max(longest, lists.back().size());
+    }
+    std::vector<PageId> page_ids;
+    for (size_t i = 0; i < longest; i++) {
+        for (auto &list : lists) {
+            if (i < list.size()) {
+                page_ids.push_back(list[i]);
+            }
+        }
+    }
+    return page_ids;
+}
+
+/**
+ * @description: 在线调整缓冲池的大小，目标帧数平均分配到各个分区，每个分区以chunk为单位扩容或缩容。
+ *              缩容时淘汰末尾chunk中的页面并写回脏页，仍被固定的页面所在的chunk不会被回收，
+ *              因此返回的实际大小可能大于目标大小
+ * @return {size_t} 调整之后缓冲池可容纳页面的个数
+ * @param {size_t} new_pool_size 目标帧数，不小于分区数
  */
-void BufferPoolManager::flush_all_pages(int fd) {
-    
-}
\ No newline at end of file
+size_t BufferPoolManager::resize(size_t new_pool_size) {
+    std::scoped_lock lock{resize_latch_};
+    new_pool_size = std::max(new_pool_size, instances_.size());
+    size_t base = new_pool_size / instances_.size();
+    size_t remain = new_pool_size % instances_.size();
+    size_t total = 0;
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        total += instances_[i]->resize(base + (i < remain ? 1 : 0));
+    }
+    pool_size_ = total;
+    return total;
+}
@@ -12,50 +12,83 @@ See the Mulan PSL v2 for more details. */
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "buffer_access_strategy.h"
+#include "buffer_pool_instance.h"
+#include "io_worker_pool.h"
 #include "disk_manager.h"
 #include "errors.h"
 #include "page.h"
+#include "page_guard.h"
 #include "replacer/lru_replacer.h"
 #include "replacer/replacer.h"
 
+/**
+ * @description: flush_all_pages的写回统计
+ */
+struct FlushStats {
+    size_t num_pages = 0;   // 写回的页面数
+    size_t num_bytes = 0;   // 写回的字节数
+    size_t num_writes = 0;  // 相邻页面合并之后的写请求数
+
+    FlushStats &operator+=(const FlushStats &other) {
+        num_pages += other.num_pages;
+        num_bytes += other.num_bytes;
+        num_writes += other.num_writes;
+        return *this;
+    }
+};
+
+/**
+ * @description: 缓冲池管理器。帧被划分到num_instances个BufferPoolInstance中，
+ * 每个分区拥有独立的页表、空闲链表、替换器和互斥锁，页面按照PageId的哈希值固定映射到某一个分区，
+ * 从而避免所有线程竞争同一把全局锁。num_instances为1时与单一缓冲池的行为完全一致
+ */
 class BufferPoolManager {
    private:
-    size_t pool_size_;      // buffer_pool中可容纳页面的个数，即帧的个数
-    Page *pages_;           // buffer_pool中的Page对象数组，在构造空间中申请内存空间，在析构函数中释放，大小为BUFFER_POOL_SIZE
-    std::unordered_map<PageId, frame_id_t, PageIdHash> page_table_; // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号
-    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+    std::atomic<size_t> pool_size_;     // buffer_pool中可容纳页面的个数，即所有分区帧的个数之和
+    std::mutex resize_latch_;           // 串行化resize
     DiskManager *disk_manager_;
-    Replacer *replacer_;    // buffer_pool的置换策略，当前赛题中为LRU置换策略
-    std::mutex latch_;      // 用于共享数据结构的并发控制
+    std::vector<std::unique_ptr<BufferPoolInstance>> instances_;    // 缓冲池分区
+    std::unique_ptr<IoWorkerPool> io_workers_;  // 执行预读的后台线程，必须在instances_之后声明以便先于分区析构
+
+    std::thread flusher_;                   // 后台刷脏线程，在析构函数中停止
+    std::mutex flusher_latch_;              // 保护flusher_stop_
+    std::condition_variable flusher_cv_;    // 用于唤醒等待中的刷脏线程
+    bool flusher_stop_ = false;
+    std::function<lsn_t()> persisted_lsn_;  // 返回已经持久化的最大日志号，为空时不检查WAL
+    std::atomic<size_t> bg_flush_rate_{BG_FLUSH_RATE};              // 刷脏线程每秒最多写回的页面数，0表示暂停
+    std::atomic<double> bg_clean_ratio_{BG_FLUSH_CLEAN_RATIO};      // replacer尾部应当保持干净的帧的比例
+    std::atomic<size_t> bg_flushed_pages_{0};                       // 刷脏线程累计写回的页面数
+    size_t bg_flush_next_instance_ = 0;                             // 下一轮刷脏开始的分区
 
    public:
-    BufferPoolManager(size_t pool_size, DiskManager *disk_manager)
+    BufferPoolManager(size_t pool_size, DiskManager *disk_manager, size_t num_instances = 1)
         : pool_size_(pool_size), disk_manager_(disk_manager) {
-        // 为buffer pool分配一块连续的内存空间
-        pages_ = new Page[pool_size_];
-        // 可以被Replacer改变
-        if (REPLACER_TYPE.compare("LRU"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else if (REPLACER_TYPE.compare("CLOCK"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else {
-            replacer_ = new LRUReplacer(pool_size_);
-        }
-        // 初始化时，所有的page都在free_list_中
-        for (size_t i = 0; i < pool_size_; ++i) {
-            free_list_.emplace_back(static_cast<frame_id_t>(i));  // static_cast转换数据类型
+        // 分区数不能超过帧数，保证每个分区至少有一个帧
+        if (num_instances == 0) num_instances = 1;
+        if (num_instances > pool_size) num_instances = pool_size;
+        // 帧平均分配到各个分区，余数分配给前面的分区
+        size_t base = pool_size / num_instances;
+        size_t remain = pool_size % num_instances;
+        instances_.reserve(num_instances);
+        for (size_t i = 0; i < num_instances; ++i) {
+            instances_.emplace_back(std::make_unique<BufferPoolInstance>(base + (i < remain ? 1 : 0), disk_manager_));
         }
+        io_workers_ = std::make_unique<IoWorkerPool>(IO_WORKER_THREADS);
     }
 
-    ~BufferPoolManager() {
-        delete[] pages_;
-        delete replacer_;
-    }
+    ~BufferPoolManager() { stop_background_flusher(); }
 
     /**
      * @description: 将目标页面标记为脏页
@@ -63,8 +96,30 @@ class BufferPoolManager {
      */
     static void mark_dirty(Page* page) { page->is_dirty_ = true; }
 
-   public: 
-    Page* fetch_page(PageId page_id);
+    size_t get_pool_size() const { return pool_size_; }
+
+    size_t get_num_instances() const { return instances_.size(); }
+
+    size_t resize(size_t new_pool_size);
+
+    void set_bg_flush_rate(size_t pages_per_sec) { bg_flush_rate_ = pages_per_sec; }
+
+    size_t get_bg_flush_rate() const { return bg_flush_rate_; }
+
+    void set_bg_clean_ratio(double clean_ratio) { bg_clean_ratio_ = clean_ratio; }
+
+    double get_bg_clean_ratio() const { return bg_clean_ratio_; }
+
+    size_t get_bg_flushed_pages() const { return bg_flushed_pages_; }
+
+   public:
+    Page* fetch_page(PageId page_id, BufferAccessStrategy *strategy = nullptr);
+
+    ReadPageGuard fetch_page_read(PageId page_id, BufferAccessStrategy *strategy = nullptr);
+
+    WritePageGuard fetch_page_write(PageId page_id);
+
+    WritePageGuard try_fetch_page_write(PageId page_id);
 
     bool unpin_page(PageId page_id, bool is_dirty);
 
@@ -74,10 +129,30 @@ class BufferPoolManager {
 
     bool delete_page(PageId page_id);
 
-    void flush_all_pages(int fd);
+    bool free_page(PageId page_id);
+
+    bool free_page(WritePageGuard &guard);
+
+    FlushStats flush_all_pages(int fd);
+
+    void release_strategy(BufferAccessStrategy *strategy);
+
+    void prefetch_pages(int fd, page_id_t first, int count, std::shared_ptr<BufferAccessStrategy> strategy = nullptr);
+
+    void prefetch_chain(int fd, page_id_t first, int count, std::function<page_id_t(Page *)> next_page);
+
+    void wait_prefetch() { io_workers_->wait_idle(); }
+
+    void start_background_flusher(std::function<lsn_t()> persisted_lsn = nullptr);
+
+    void stop_background_flusher();
+
+    size_t bg_flush_round();
+
+    std::vector<PageId> get_resident_pages();
 
    private:
-    bool find_victim_page(frame_id_t* frame_id);
+    size_t get_instance_index(PageId page_id);
 
-    void update_page(Page* page, PageId new_page_id, frame_id_t new_frame_id);
-};
\ No newline at end of file
+    BufferPoolInstance* get_instance(PageId page_id);
+};
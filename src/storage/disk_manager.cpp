@@ -11,13 +11,43 @@ See the Mulan PSL v2 for more details. */
 #include "storage/disk_manager.h"
 
 #include <assert.h>    // for assert
+#include <stdlib.h>    // for aligned_alloc
 #include <string.h>    // for memset
 #include <sys/stat.h>  // for stat
-#include <unistd.h>    // for lseek
+#include <unistd.h>    // for pread, pwrite
+
+#include <condition_variable>
 
 #include "defs.h"
 
-DiskManager::DiskManager() { memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<page_id_t>) / sizeof(char))); }
+namespace {
+
+/**
+ * @description: O_DIRECT要求读写的内存地址、长度和文件偏移都按块对齐。
+ * 缓冲池中的页面满足要求；文件头等不满足要求的读写通过按PAGE_SIZE对齐的临时缓冲区中转
+ */
+bool is_page_aligned(const char *buf, int num_bytes) {
+    return reinterpret_cast<uintptr_t>(buf) % PAGE_SIZE == 0 && num_bytes % PAGE_SIZE == 0;
+}
+
+struct BounceBuffer {
+    explicit BounceBuffer(int num_bytes) {
+        size = (num_bytes + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+        data = static_cast<char *>(aligned_alloc(PAGE_SIZE, size));
+        if (data == nullptr) {
+            throw std::bad_alloc();
+        }
+        memset(data, 0, size);
+    }
+    ~BounceBuffer() { free(data); }
+
+    char *data;
+    int size;
+};
+
+}  // namespace
+
+DiskManager::DiskManager() = default;
 
 /**
  * @description: 将数据写入文件的指定磁盘页面中
@@ -27,11 +57,32 @@ DiskManager::DiskManager() { memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<
  * @param {int} num_bytes 要写入磁盘的数据大小
  */
 void DiskManager::write_page(int fd, page_id_t page_no, const char *offset, int num_bytes) {
-    // Todo:
-    // 1.lseek()定位到文件头，通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量
-    // 2.调用write()函数
-    // 注意write返回值与num_bytes不等时 throw InternalError("DiskManager::write_page Error");
-
+    FileEntry &file = files_.entry(fd);
+    uint64_t start_us = io_stats_now_us();
+    if (file.direct_io && !is_page_aligned(offset, num_bytes)) {
+        // 不足一页的部分要保留磁盘上原有的内容，先读出最后一页再覆盖
+        BounceBuffer bounce(num_bytes);
+        off_t pos = static_cast<off_t>(page_no) * PAGE_SIZE;
+        if (num_bytes % PAGE_SIZE != 0) {
+            int last = bounce.size - PAGE_SIZE;
+            if (pread(fd, bounce.data + last, PAGE_SIZE, pos + last) < 0) {
+                throw InternalError("DiskManager::write_page Error");
+            }
+        }
+        memcpy(bounce.data, offset, num_bytes);
+        if (pwrite(fd, bounce.data, bounce.size, pos) != bounce.size) {
+            throw InternalError("DiskManager::write_page Error");
+        }
+        record_io(file, true, num_bytes, start_us);
+        return;
+    }
+    // 通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量
+    // 使用pwrite()而不是lseek()+write()，一次系统调用完成，并且不修改共享的文件偏移，多个线程可以并发读写同一个文件
+    ssize_t bytes_write = pwrite(fd, offset, num_bytes, static_cast<off_t>(page_no) * PAGE_SIZE);
+    if (bytes_write != num_bytes) {
+        throw InternalError("DiskManager::write_page Error");
+    }
+    record_io(file, true, num_bytes, start_us);
 }
 
 /**
@@ -42,25 +93,213 @@ void DiskManager::write_page(int fd, page_id_t page_no, const char *offset, int
  * @param {int} num_bytes 读取的数据量大小
  */
 void DiskManager::read_page(int fd, page_id_t page_no, char *offset, int num_bytes) {
-    // Todo:
-    // 1.lseek()定位到文件头，通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量
-    // 2.调用read()函数
-    // 注意read返回值与num_bytes不等时，throw InternalError("DiskManager::read_page Error");
+    FileEntry &file = files_.entry(fd);
+    uint64_t start_us = io_stats_now_us();
+    if (file.direct_io && !is_page_aligned(offset, num_bytes)) {
+        BounceBuffer bounce(num_bytes);
+        if (pread(fd, bounce.data, bounce.size, static_cast<off_t>(page_no) * PAGE_SIZE) < num_bytes) {
+            throw InternalError("DiskManager::read_page Error");
+        }
+        memcpy(offset, bounce.data, num_bytes);
+        record_io(file, false, num_bytes, start_us);
+        return;
+    }
+    // 通过(fd,page_no)可以定位指定页面及其在磁盘文件中的偏移量，使用pread()读取
+    ssize_t bytes_read = pread(fd, offset, num_bytes, static_cast<off_t>(page_no) * PAGE_SIZE);
+    if (bytes_read != num_bytes) {
+        throw InternalError("DiskManager::read_page Error");
+    }
+    record_io(file, false, num_bytes, start_us);
+}
 
+/**
+ * @description: 把一次完成的读写计入文件和全局的读写统计，延迟计入全局的延迟分布
+ * @param {FileEntry&} file 读写的文件
+ * @param {bool} is_write true表示写，false表示读
+ * @param {int} num_bytes 读写的字节数
+ * @param {uint64_t} start_us 读写开始的时间
+ */
+void DiskManager::record_io(FileEntry &file, bool is_write, int num_bytes, uint64_t start_us) {
+    uint64_t elapsed_us = io_stats_now_us() - start_us;
+    IoCounter num_ops = is_write ? NUM_WRITES : NUM_READS;
+    IoCounter bytes = is_write ? BYTES_WRITTEN : BYTES_READ;
+    IoCounter time_us = is_write ? WRITE_TIME_US : READ_TIME_US;
+    for (IoCounters *stats : {&file.stats, &io_stats_.counters}) {
+        stats->add(num_ops);
+        stats->add(bytes, num_bytes);
+        stats->add(time_us, elapsed_us);
+    }
+    (is_write ? io_stats_.write_latency : io_stats_.read_latency).record(elapsed_us);
 }
 
 /**
- * @description: 分配一个新的页号
+ * @description: 包装一批异步读写请求的完成回调，请求成功完成时把它计入读写统计，延迟从提交时开始计算
+ * @param {vector<AsyncIoRequest>&} requests 要提交的请求
+ */
+void DiskManager::record_requests(std::vector<AsyncIoRequest> &requests) {
+    uint64_t start_us = io_stats_now_us();
+    for (auto &req : requests) {
+        FileEntry *file = &files_.entry(req.fd);
+        req.callback = [this, file, start_us, is_write = req.is_write, num_bytes = req.num_bytes,
+                        callback = std::move(req.callback)](ssize_t res) {
+            if (res == num_bytes) {
+                record_io(*file, is_write, num_bytes, start_us);
+            }
+            if (callback) callback(res);
+        };
+    }
+}
+
+AsyncIo *DiskManager::get_async_io() {
+    std::call_once(async_io_once_, [this] { async_io_ = AsyncIo::create(ASYNC_IO_QUEUE_DEPTH); });
+    return async_io_.get();
+}
+
+/**
+ * @description: 批量提交异步读写请求，立即返回，每个请求完成时在I/O线程中调用其callback
+ * @param {vector<AsyncIoRequest>} requests 要提交的请求
+ */
+void DiskManager::submit_async(std::vector<AsyncIoRequest> requests) {
+    if (requests.empty()) {
+        return;
+    }
+    record_requests(requests);
+    get_async_io()->submit(std::move(requests));
+}
+
+/**
+ * @description: 批量提交读写请求并等待全部完成，有请求没有读写完整时抛出异常
+ * @param {vector<AsyncIoRequest>} requests 要提交的请求
+ */
+void DiskManager::submit_and_wait(std::vector<AsyncIoRequest> requests) {
+    if (requests.empty()) {
+        return;
+    }
+    std::mutex latch;
+    std::condition_variable cv;
+    size_t remaining = requests.size();
+    bool failed = false;
+    record_requests(requests);
+    for (auto &req : requests) {
+        req.callback = [&, num_bytes = req.num_bytes, callback = std::move(req.callback)](ssize_t res) {
+            if (callback) callback(res);
+            std::scoped_lock lock{latch};
+            if (res != num_bytes) failed = true;
+            if (--remaining == 0) cv.notify_one();
+        };
+    }
+    get_async_io()->submit(std::move(requests));
+    std::unique_lock lock{latch};
+    cv.wait(lock, [&] { return remaining == 0; });
+    if (failed) {
+        throw InternalError("DiskManager::submit_and_wait Error");
+    }
+}
+
+/**
+ * @description: 分配一个新的页号，优先复用文件中已经释放的页号最小的页面，没有空闲页面时在文件末尾分配
  * @return {page_id_t} 分配的新页号
  * @param {int} fd 指定文件的文件句柄
  */
 page_id_t DiskManager::allocate_page(int fd) {
-    // 简单的自增分配策略，指定文件的页面编号加1
-    assert(fd >= 0 && fd < MAX_FD);
-    return fd2pageno_[fd]++;
+    FileEntry &file = files_.entry(fd);
+    std::scoped_lock lock{file.free_latch};
+    while (!file.free_pages.empty()) {
+        page_id_t page_no = *file.free_pages.begin();
+        file.free_pages.erase(file.free_pages.begin());
+        // 文件被截断后，超出文件末尾的空闲页面已经不存在
+        if (page_no < file.num_pages) {
+            return page_no;
+        }
+    }
+    // 没有空闲页面，指定文件的页面编号加1
+    return file.num_pages++;
 }
 
-void DiskManager::deallocate_page(__attribute__((unused)) page_id_t page_id) {}
+/**
+ * @description: 释放一个页面，之后allocate_page可以把它重新分配出去。
+ *              调用者需保证页面已经不在缓冲池中，也不会再被访问
+ * @param {int} fd 指定文件的文件句柄
+ * @param {page_id_t} page_no 释放的页号
+ */
+void DiskManager::deallocate_page(int fd, page_id_t page_no) {
+    FileEntry &file = files_.entry(fd);
+    if (page_no < 0 || page_no >= file.num_pages) {
+        return;
+    }
+    std::scoped_lock lock{file.free_latch};
+    file.free_pages.insert(page_no);
+}
+
+/**
+ * @description: 取回一个已经释放的页面，使它不会再被allocate_page分配出去，例如回滚删除时需要重新使用被释放的记录页
+ * @return {bool} 页面在空闲列表中则返回true，否则返回false(页面没有被释放，或者已经被重新分配)
+ * @param {int} fd 指定文件的文件句柄
+ * @param {page_id_t} page_no 页号
+ */
+bool DiskManager::reclaim_page(int fd, page_id_t page_no) {
+    FileEntry &file = files_.entry(fd);
+    std::scoped_lock lock{file.free_latch};
+    return file.free_pages.erase(page_no) > 0;
+}
+
+/**
+ * @description: 收缩文件：把文件末尾连续的空闲页面截断，归还磁盘空间。文件可以处于使用中，
+ *              截断的页面都已经释放，不会再被访问；文件中间的空闲页面保留在空闲列表中等待复用
+ * @return {int} 截断的页面个数
+ * @param {int} fd 指定文件的文件句柄
+ */
+int DiskManager::shrink_file(int fd) {
+    FileEntry &file = files_.entry(fd);
+    std::scoped_lock lock{file.free_latch};
+    auto &free_pages = file.free_pages;
+    page_id_t num_pages = file.num_pages;
+    while (num_pages > 0 && free_pages.count(num_pages - 1)) {
+        free_pages.erase(num_pages - 1);
+        num_pages--;
+    }
+    free_pages.erase(free_pages.lower_bound(num_pages), free_pages.end());
+    int truncated = file.num_pages - num_pages;
+    if (truncated > 0) {
+        if (ftruncate(fd, static_cast<off_t>(num_pages) * PAGE_SIZE) < 0) {
+            throw UnixError();
+        }
+        file.num_pages = num_pages;
+    }
+    return truncated;
+}
+
+/**
+ * @description: 获得文件中等待复用的空闲页面个数
+ * @return {size_t} 空闲页面个数
+ * @param {int} fd 指定文件的文件句柄
+ */
+size_t DiskManager::get_num_free_pages(int fd) {
+    FileEntry &file = files_.entry(fd);
+    std::scoped_lock lock{file.free_latch};
+    return file.free_pages.size();
+}
+
+/**
+ * @description: 获得文件中页号最小的空闲页面，即allocate_page下一次优先复用的页面
+ * @return {page_id_t} 空闲页面的页号，没有空闲页面时返回INVALID_PAGE_ID
+ * @param {int} fd 指定文件的文件句柄
+ */
+page_id_t DiskManager::get_min_free_page(int fd) {
+    FileEntry &file = files_.entry(fd);
+    std::scoped_lock lock{file.free_latch};
+    // 超出文件末尾的空闲页面不会再被分配，见allocate_page
+    if (file.free_pages.empty() || *file.free_pages.begin() >= file.num_pages) {
+        return INVALID_PAGE_ID;
+    }
+    return *file.free_pages.begin();
+}
+
+/**
+ * @description: 获得文件自打开以来的I/O统计，包括缓冲池事件和磁盘读写
+ * @param {int} fd 指定文件的文件句柄
+ */
+FileIoStats DiskManager::get_file_io_stats(int fd) { return FileIoStats::from(files_.entry(fd).stats); }
 
 bool DiskManager::is_dir(const std::string& path) {
     struct stat st;
@@ -99,9 +338,16 @@ bool DiskManager::is_file(const std::string &path) {
  * @param {string} &path
  */
 void DiskManager::create_file(const std::string &path) {
-    // Todo:
-    // 调用open()函数，使用O_CREAT模式
     // 注意不能重复创建相同文件
+    if (is_file(path)) {
+        throw FileExistsError(path);
+    }
+    // 调用open()函数，使用O_CREAT模式
+    int fd = open(path.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        throw UnixError();
+    }
+    close(fd);
 }
 
 /**
@@ -109,10 +355,21 @@ void DiskManager::create_file(const std::string &path) {
  * @param {string} &path 文件所在路径
  */
 void DiskManager::destroy_file(const std::string &path) {
-    // Todo:
-    // 调用unlink()函数
+    if (!is_file(path)) {
+        throw FileNotFoundError(path);
+    }
     // 注意不能删除未关闭的文件
-    
+    if (files_.is_open(path)) {
+        throw FileNotClosedError(path);
+    }
+    // 调用unlink()函数，文件的空闲页面列表一起删除
+    if (unlink(path.c_str()) < 0) {
+        throw UnixError();
+    }
+    std::string free_path = path + FREE_LIST_SUFFIX;
+    if (is_file(free_path)) {
+        unlink(free_path.c_str());
+    }
 }
 
 
@@ -120,12 +377,14 @@ void DiskManager::destroy_file(const std::string &path) {
  * @description: 打开指定路径文件 
  * @return {int} 返回打开的文件的文件句柄
  * @param {string} &path 文件所在路径
+ * @param {bool} direct_io 是否使用O_DIRECT绕过内核页缓存，文件系统不支持O_DIRECT时(如tmpfs)退化为普通模式
  */
-int DiskManager::open_file(const std::string &path) {
-    // Todo:
-    // 调用open()函数，使用O_RDWR模式
-    // 注意不能重复打开相同文件，并且需要更新文件打开列表
-
+int DiskManager::open_file(const std::string &path, bool direct_io) {
+    if (!is_file(path)) {
+        throw FileNotFoundError(path);
+    }
+    // 重复打开检查、open()调用和登记文件打开列表在文件表的锁内完成，读入文件的空闲页面列表
+    return files_.open(path, direct_io);
 }
 
 /**
@@ -133,10 +392,8 @@ int DiskManager::open_file(const std::string &path) {
  * @param {int} fd 打开的文件的文件句柄
  */
 void DiskManager::close_file(int fd) {
-    // Todo:
-    // 调用close()函数
-    // 注意不能关闭未打开的文件，并且需要更新文件打开列表
-
+    // 注意不能关闭未打开的文件；保存空闲页面列表，调用close()函数，更新文件打开列表
+    files_.close(fd);
 }
 
 
@@ -157,10 +414,7 @@ int DiskManager::get_file_size(const std::string &file_name) {
  * @param {int} fd 文件句柄
  */
 std::string DiskManager::get_file_name(int fd) {
-    if (!fd2path_.count(fd)) {
-        throw FileNotOpenError(fd);
-    }
-    return fd2path_[fd];
+    return files_.get_path(fd);
 }
 
 /**
@@ -169,10 +423,11 @@ std::string DiskManager::get_file_name(int fd) {
  * @param {string} &file_name 文件名
  */
 int DiskManager::get_file_fd(const std::string &file_name) {
-    if (!path2fd_.count(file_name)) {
+    int fd = files_.find(file_name);
+    if (fd < 0) {
         return open_file(file_name);
     }
-    return path2fd_[file_name];
+    return fd;
 }
 
 
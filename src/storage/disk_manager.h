@@ -17,11 +17,16 @@ See the Mulan PSL v2 for more details. */
 #include <atomic>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "async_io.h"
 #include "common/config.h"
 #include "errors.h"  
+#include "file_table.h"
 
 /**
  * @description: DiskManager的作用主要是根据上层的需要对磁盘文件进行操作
@@ -36,9 +41,24 @@ class DiskManager {
 
     void read_page(int fd, page_id_t page_no, char *offset, int num_bytes);
 
+    /*批量异步读写*/
+    void submit_async(std::vector<AsyncIoRequest> requests);
+
+    void submit_and_wait(std::vector<AsyncIoRequest> requests);
+
+    std::string get_async_io_name() { return get_async_io()->name(); }
+
     page_id_t allocate_page(int fd);
 
-    void deallocate_page(page_id_t page_id);
+    void deallocate_page(int fd, page_id_t page_no);
+
+    bool reclaim_page(int fd, page_id_t page_no);
+
+    int shrink_file(int fd);
+
+    size_t get_num_free_pages(int fd);
+
+    page_id_t get_min_free_page(int fd);
 
     /*目录操作*/
     bool is_dir(const std::string &path);
@@ -54,7 +74,9 @@ class DiskManager {
 
     void destroy_file(const std::string &path);
 
-    int open_file(const std::string &path);
+    int open_file(const std::string &path, bool direct_io = false);
+
+    bool is_direct_io(int fd) { return files_.entry(fd).direct_io; }
 
     void close_file(int fd);
 
@@ -78,22 +100,54 @@ class DiskManager {
      * @param {int} fd 文件对应的文件句柄
      * @param {int} start_page_no 已经分配的页面个数，即文件接下来从start_page_no开始分配页面编号
      */
-    void set_fd2pageno(int fd, int start_page_no) { fd2pageno_[fd] = start_page_no; }
+    void set_fd2pageno(int fd, int start_page_no) { files_.entry(fd).num_pages = start_page_no; }
 
     /**
      * @description: 获得文件目前已分配的页面个数，即如果文件要分配一个新页面，需要从fd2pagenp_[fd]开始分配
      * @return {page_id_t} 已分配的页面个数 
      * @param {int} fd 文件对应的句柄
      */
-    page_id_t get_fd2pageno(int fd) { return fd2pageno_[fd]; }
+    page_id_t get_fd2pageno(int fd) { return files_.entry(fd).num_pages; }
+
+    FileIoStats get_file_io_stats(int fd);
+
+    FileIoStats get_total_io_stats() { return FileIoStats::from(io_stats_.counters); }
+
+    const IoStats &get_io_stats() const { return io_stats_; }
+
+    std::vector<std::pair<int, std::string>> list_open_files() { return files_.list_open_files(); }
+
+    /**
+     * @description: 记录一个缓冲池事件，同时计入文件和全局的统计
+     * @param {int} fd 页面所在文件的文件句柄
+     * @param {IoCounter} counter 事件对应的计数器
+     * @param {uint64_t} n 计数器的增量
+     */
+    void record_event(int fd, IoCounter counter, uint64_t n = 1) {
+        files_.entry(fd).stats.add(counter, n);
+        io_stats_.counters.add(counter, n);
+    }
+
+    void record_miss_latency(uint64_t us) { io_stats_.miss_latency.record(us); }
+
+    static constexpr int MAX_FD = FileTable::MAX_FD;
 
-    static constexpr int MAX_FD = 8192;
+    static constexpr const char *FREE_LIST_SUFFIX = FileTable::FREE_LIST_SUFFIX;   // 空闲页面列表文件的后缀
 
    private:
-    // 文件打开列表，用于记录文件是否被打开
-    std::unordered_map<std::string, int> path2fd_;  //<Page文件磁盘路径,Page fd>哈希表
-    std::unordered_map<int, std::string> fd2path_;  //<Page fd,Page文件磁盘路径>哈希表
+    // 文件打开列表，记录每个打开文件的路径、已分配的页面个数、空闲页面和读写统计
+    FileTable files_;
+
+    IoStats io_stats_;                            // 全局I/O统计，文件关闭后仍然保留
 
     int log_fd_ = -1;                             // WAL日志文件的文件句柄，默认为-1，代表未打开日志文件
-    std::atomic<page_id_t> fd2pageno_[MAX_FD]{};  // 文件中已经分配的页面个数，初始值为0
+
+    std::once_flag async_io_once_;
+    std::unique_ptr<AsyncIo> async_io_;           // 批量异步读写的后端，第一次使用时创建
+
+    AsyncIo *get_async_io();
+
+    void record_io(FileEntry &file, bool is_write, int num_bytes, uint64_t start_us);
+
+    void record_requests(std::vector<AsyncIoRequest> &requests);
 };
\ No newline at end of file
@@ -0,0 +1,196 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/file_table.h"
+
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "errors.h"
+
+FileTable::~FileTable() {
+    for (auto &slot : entries_) {
+        delete slot.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @description: 获得文件句柄对应的表项，表项不存在时创建。不获取表锁
+ * @return {FileEntry&} 文件句柄对应的表项
+ * @param {int} fd 文件句柄
+ */
+FileEntry &FileTable::entry(int fd) {
+    assert(fd >= 0 && fd < MAX_FD);
+    FileEntry *entry = entries_[fd].load(std::memory_order_acquire);
+    if (entry != nullptr) {
+        return *entry;
+    }
+    auto created = std::make_unique<FileEntry>();
+    if (entries_[fd].compare_exchange_strong(entry, created.get(), std::memory_order_acq_rel)) {
+        return *created.release();
+    }
+    return *entry;
+}
+
+/**
+ * @description: 打开文件并登记到文件表中，读入关闭时保存的空闲页面列表
+ * @return {int} 文件句柄
+ * @param {string&} path 文件路径
+ * @param {bool} direct_io 是否使用O_DIRECT绕过内核页缓存，文件系统不支持O_DIRECT时(如tmpfs)退化为普通模式
+ */
+int FileTable::open(const std::string &path, bool direct_io) {
+    std::unique_lock lock{latch_};
+    // 注意不能重复打开相同文件，检查和登记在同一个临界区中完成
+    if (path2fd_.count(path)) {
+        throw FileNotClosedError(path);
+    }
+    int fd = direct_io ? ::open(path.c_str(), O_RDWR | O_DIRECT) : -1;
+    if (fd < 0) {
+        direct_io = false;
+        fd = ::open(path.c_str(), O_RDWR);
+    }
+    if (fd < 0) {
+        throw UnixError();
+    }
+    if (fd >= MAX_FD) {
+        ::close(fd);
+        throw InternalError("FileTable::open too many open files");
+    }
+    FileEntry &file = entry(fd);
+    file.path = path;
+    file.direct_io = direct_io;
+    file.num_pages = 0;
+    file.stats.reset();
+    load_free_pages(file);
+    file.is_open = true;
+    path2fd_[path] = fd;
+    return fd;
+}
+
+/**
+ * @description: 关闭文件并从文件表中删除，关闭前保存空闲页面列表
+ * @param {int} fd 文件句柄
+ */
+void FileTable::close(int fd) {
+    std::unique_lock lock{latch_};
+    // 注意不能关闭未打开的文件
+    if (fd < 0 || fd >= MAX_FD || !entry(fd).is_open) {
+        throw FileNotOpenError(fd);
+    }
+    FileEntry &file = entry(fd);
+    save_free_pages(file);
+    file.is_open = false;
+    file.direct_io = false;
+    path2fd_.erase(file.path);
+    file.path.clear();
+    // 句柄关闭后可能立即被其他线程打开的文件复用，必须在表锁内关闭
+    ::close(fd);
+}
+
+bool FileTable::is_open(const std::string &path) {
+    std::shared_lock lock{latch_};
+    return path2fd_.count(path) > 0;
+}
+
+/**
+ * @description: 按路径查找打开的文件
+ * @return {int} 文件句柄，文件没有打开时返回-1
+ * @param {string&} path 文件路径
+ */
+int FileTable::find(const std::string &path) {
+    std::shared_lock lock{latch_};
+    auto pos = path2fd_.find(path);
+    return pos == path2fd_.end() ? -1 : pos->second;
+}
+
+/**
+ * @description: 获得打开文件的路径
+ * @return {string} 文件路径
+ * @param {int} fd 文件句柄
+ */
+std::string FileTable::get_path(int fd) {
+    std::shared_lock lock{latch_};
+    if (fd < 0 || fd >= MAX_FD || !entry(fd).is_open) {
+        throw FileNotOpenError(fd);
+    }
+    return entry(fd).path;
+}
+
+/**
+ * @description: 列出所有打开的文件，按文件句柄排序
+ * @return {vector<pair<int, string>>} 文件句柄和路径
+ */
+std::vector<std::pair<int, std::string>> FileTable::list_open_files() {
+    std::shared_lock lock{latch_};
+    std::vector<std::pair<int, std::string>> files(path2fd_.size());
+    std::transform(path2fd_.begin(), path2fd_.end(), files.begin(),
+                   [](auto &item) { return std::make_pair(item.second, item.first); });
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+/**
+ * @description: 打开文件时读入关闭时保存的空闲页面列表，读入后删除列表文件。
+ *              文件打开期间空闲列表只保存在内存中，若数据库崩溃，列表文件不存在，
+ *              这些页面只是不会被复用，不会因为过期的列表把正在使用的页面再次分配出去
+ * @param {FileEntry&} file 文件的表项
+ */
+void FileTable::load_free_pages(FileEntry &file) {
+    std::set<page_id_t> free_pages;
+    std::string free_path = file.path + FREE_LIST_SUFFIX;
+    std::ifstream ifs(free_path, std::ios::binary);
+    if (ifs.is_open()) {
+        page_id_t page_no;
+        while (ifs.read(reinterpret_cast<char *>(&page_no), sizeof(page_no))) {
+            free_pages.insert(page_no);
+        }
+        ifs.close();
+        unlink(free_path.c_str());
+    }
+    std::scoped_lock lock{file.free_latch};
+    file.free_pages = std::move(free_pages);
+}
+
+/**
+ * @description: 关闭文件时把空闲页面列表写入列表文件，先写临时文件再重命名
+ * @param {FileEntry&} file 文件的表项
+ */
+void FileTable::save_free_pages(FileEntry &file) {
+    std::set<page_id_t> free_pages;
+    {
+        std::scoped_lock lock{file.free_latch};
+        free_pages.swap(file.free_pages);
+    }
+    if (free_pages.empty()) {
+        return;
+    }
+    std::string free_path = file.path + FREE_LIST_SUFFIX;
+    std::string tmp_path = free_path + ".tmp";
+    {
+        std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+        for (page_id_t page_no : free_pages) {
+            if (page_no >= file.num_pages) {
+                break;
+            }
+            ofs.write(reinterpret_cast<const char *>(&page_no), sizeof(page_no));
+        }
+        if (!ofs) {
+            throw UnixError();
+        }
+    }
+    if (rename(tmp_path.c_str(), free_path.c_str()) < 0) {
+        throw UnixError();
+    }
+}
@@ -0,0 +1,84 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "io_stats.h"
+
+/**
+ * @description: 文件表中一个打开文件的状态。表项在文件句柄第一次被使用时创建，
+ * 文件关闭后保留，句柄被重新分配给另一个文件时复用
+ */
+struct FileEntry {
+    std::string path;                           // 文件路径，由文件表的锁保护
+    std::atomic<bool> is_open{false};           // 文件是否打开
+    std::atomic<bool> direct_io{false};         // 文件是否以O_DIRECT模式打开
+    std::atomic<page_id_t> num_pages{0};        // 文件中已经分配的页面个数
+
+    std::mutex free_latch;                      // 保护free_pages，分配和释放页面时获取
+    std::set<page_id_t> free_pages;             // 已经释放、可以复用的页面号
+
+    IoCounters stats;                           // 文件自打开以来的I/O统计，下标为IoCounter
+};
+
+/**
+ * @description: DiskManager的文件表，以文件句柄为下标的稠密数组保存每个打开文件的状态。
+ * 打开和关闭文件时持有写锁，按路径查找时持有读锁；
+ * 页面读写和页面分配通过文件句柄直接定位表项，不需要计算字符串哈希，也不需要获取表锁。
+ * 操作系统总是分配最小的空闲文件句柄，因此句柄本身就是稠密的小整数
+ */
+class FileTable {
+   public:
+    static constexpr int MAX_FD = 8192;
+
+    static constexpr const char *FREE_LIST_SUFFIX = ".free";   // 空闲页面列表文件的后缀
+
+    FileTable() = default;
+
+    ~FileTable();
+
+    FileTable(const FileTable &) = delete;
+    FileTable &operator=(const FileTable &) = delete;
+
+    int open(const std::string &path, bool direct_io);
+
+    void close(int fd);
+
+    FileEntry &entry(int fd);
+
+    bool is_open(const std::string &path);
+
+    int find(const std::string &path);
+
+    std::string get_path(int fd);
+
+    std::vector<std::pair<int, std::string>> list_open_files();
+
+   private:
+    std::shared_mutex latch_;                       // 保护path2fd_和表项的path，打开和关闭文件时持有写锁
+    std::atomic<FileEntry *> entries_[MAX_FD]{};    // 以文件句柄为下标的表项
+    std::unordered_map<std::string, int> path2fd_;  // 打开文件的路径到文件句柄的索引，只在打开文件和按路径查找时使用
+
+    void load_free_pages(FileEntry &entry);
+
+    void save_free_pages(FileEntry &entry);
+};
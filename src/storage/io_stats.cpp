@@ -0,0 +1,59 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "io_stats.h"
+
+#include <cmath>
+
+uint64_t LatencyHistogram::count() const {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        sum += counters_.get(i);
+    }
+    return sum;
+}
+
+uint64_t LatencyHistogram::percentile_us(double quantile) const {
+    uint64_t buckets[NUM_BUCKETS];
+    uint64_t total = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        buckets[i] = counters_.get(i);
+        total += buckets[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    // 分位数对应第ceil(quantile * total)个样本
+    uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(quantile * total)), 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return static_cast<uint64_t>(1) << i;
+        }
+    }
+    return static_cast<uint64_t>(1) << (NUM_BUCKETS - 1);
+}
+
+FileIoStats FileIoStats::from(const IoCounters &counters) {
+    FileIoStats stats;
+    stats.fetch_hits = counters.get(FETCH_HITS);
+    stats.fetch_misses = counters.get(FETCH_MISSES);
+    stats.evictions = counters.get(EVICTIONS);
+    stats.dirty_writebacks = counters.get(DIRTY_WRITEBACKS);
+    stats.flushed_pages = counters.get(FLUSHED_PAGES);
+    stats.num_reads = counters.get(NUM_READS);
+    stats.bytes_read = counters.get(BYTES_READ);
+    stats.read_time_us = counters.get(READ_TIME_US);
+    stats.num_writes = counters.get(NUM_WRITES);
+    stats.bytes_written = counters.get(BYTES_WRITTEN);
+    stats.write_time_us = counters.get(WRITE_TIME_US);
+    return stats;
+}
@@ -0,0 +1,154 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "common/config.h"
+
+/**
+ * @description: I/O统计计数器的下标。缓冲池事件和磁盘读写都按文件计数，同时计入全局统计
+ */
+enum IoCounter : size_t {
+    FETCH_HITS = 0,     // fetch_page命中缓冲池
+    FETCH_MISSES,       // fetch_page需要从磁盘读入
+    EVICTIONS,          // 淘汰的页面数
+    DIRTY_WRITEBACKS,   // 淘汰时同步写回的脏页数
+    FLUSHED_PAGES,      // flush_page、flush_all_pages和后台刷脏写回的页面数
+    NUM_READS,          // 读操作次数
+    BYTES_READ,         // 读取的字节数
+    READ_TIME_US,       // 读操作的累计耗时
+    NUM_WRITES,         // 写操作次数
+    BYTES_WRITTEN,      // 写入的字节数
+    WRITE_TIME_US,      // 写操作的累计耗时
+    NUM_IO_COUNTERS
+};
+
+/** @return 当前线程使用的计数器分片，线程第一次使用时按顺序分配 */
+inline size_t io_stats_stripe() {
+    static std::atomic<size_t> next_stripe{0};
+    thread_local size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % IO_STATS_STRIPES;
+    return stripe;
+}
+
+/** @return 单调时钟的当前时间，单位为微秒 */
+inline uint64_t io_stats_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @description: 一组按线程分片的计数器。每个分片独占缓存行，线程只修改自己的分片，
+ * 累加不需要加锁，也不会在线程之间来回传递缓存行；读取时把所有分片相加
+ */
+template <size_t N>
+class StripedCounters {
+   public:
+    void add(size_t counter, uint64_t n = 1) {
+        stripes_[io_stats_stripe()].values[counter].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t get(size_t counter) const {
+        uint64_t sum = 0;
+        for (auto &stripe : stripes_) {
+            sum += stripe.values[counter].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    void reset() {
+        for (auto &stripe : stripes_) {
+            for (auto &value : stripe.values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+   private:
+    struct alignas(64) Stripe {
+        std::atomic<uint64_t> values[N]{};
+    };
+    Stripe stripes_[IO_STATS_STRIPES];
+};
+
+using IoCounters = StripedCounters<NUM_IO_COUNTERS>;
+
+/**
+ * @description: 按2的幂划分区间的延迟直方图，单位为微秒。第0个桶统计小于1us的样本，
+ * 第i个桶统计[2^(i-1), 2^i)us的样本，最后一个桶统计所有更大的样本。与StripedCounters一样按线程分片
+ */
+class LatencyHistogram {
+   public:
+    static constexpr size_t NUM_BUCKETS = 32;
+
+    void record(uint64_t us) {
+        size_t bucket = us == 0 ? 0 : std::min<size_t>(64 - __builtin_clzll(us), NUM_BUCKETS - 1);
+        counters_.add(bucket);
+        counters_.add(NUM_BUCKETS, us);
+    }
+
+    /** @return 样本个数 */
+    uint64_t count() const;
+
+    /** @return 所有样本的累计延迟 */
+    uint64_t sum_us() const { return counters_.get(NUM_BUCKETS); }
+
+    /**
+     * @description: 估计延迟的分位数，返回分位数所在桶的上界
+     * @return {uint64_t} 分位数的上界，没有样本时为0
+     * @param {double} quantile 分位数，取值范围(0, 1]
+     */
+    uint64_t percentile_us(double quantile) const;
+
+   private:
+    StripedCounters<NUM_BUCKETS + 1> counters_;     // 前NUM_BUCKETS个为各个桶的样本数，最后一个为累计延迟
+};
+
+/**
+ * @description: 一个文件或全局的I/O统计快照
+ */
+struct FileIoStats {
+    uint64_t fetch_hits = 0;
+    uint64_t fetch_misses = 0;
+    uint64_t evictions = 0;
+    uint64_t dirty_writebacks = 0;
+    uint64_t flushed_pages = 0;
+    uint64_t num_reads = 0;         // 读操作次数
+    uint64_t bytes_read = 0;        // 读取的字节数
+    uint64_t read_time_us = 0;
+    uint64_t num_writes = 0;        // 写操作次数
+    uint64_t bytes_written = 0;     // 写入的字节数
+    uint64_t write_time_us = 0;
+
+    static FileIoStats from(const IoCounters &counters);
+
+    /** @return 命中率，没有访问时为0 */
+    double hit_ratio() const {
+        uint64_t total = fetch_hits + fetch_misses;
+        return total == 0 ? 0 : static_cast<double>(fetch_hits) / total;
+    }
+};
+
+/**
+ * @description: DiskManager维护的全局I/O统计：所有文件的计数器之和，以及磁盘读写和缓冲池缺页的延迟分布。
+ * 文件关闭之后，它的读写仍然计入全局统计
+ */
+struct IoStats {
+    IoCounters counters;
+    LatencyHistogram read_latency;      // 磁盘读操作的延迟
+    LatencyHistogram write_latency;     // 磁盘写操作的延迟
+    LatencyHistogram miss_latency;      // fetch_page缺页的延迟，包括淘汰时写回脏页和读入页面
+};
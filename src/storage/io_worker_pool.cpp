@@ -0,0 +1,73 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "io_worker_pool.h"
+
+IoWorkerPool::IoWorkerPool(size_t num_threads) {
+    for (size_t i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&IoWorkerPool::worker_loop, this);
+    }
+}
+
+IoWorkerPool::~IoWorkerPool() {
+    std::deque<std::function<void()>> dropped;
+    {
+        std::scoped_lock lock{latch_};
+        stop_ = true;
+        dropped.swap(tasks_);
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    // 丢弃的任务在锁外析构，任务捕获的对象的析构函数可能会再次访问缓冲池
+    dropped.clear();
+}
+
+void IoWorkerPool::submit(std::function<void()> task) {
+    {
+        std::scoped_lock lock{latch_};
+        if (stop_) {
+            return;
+        }
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void IoWorkerPool::wait_idle() {
+    std::unique_lock lock{latch_};
+    idle_cv_.wait(lock, [this] { return tasks_.empty() && running_ == 0; });
+}
+
+void IoWorkerPool::worker_loop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock{latch_};
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (stop_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            running_++;
+        }
+        task();
+        task = nullptr;
+        {
+            std::scoped_lock lock{latch_};
+            running_--;
+            if (tasks_.empty() && running_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+}
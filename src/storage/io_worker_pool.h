@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @description: 执行后台I/O任务的小型线程池，用于缓冲池的预读。
+ * 任务按提交顺序执行；析构时丢弃尚未开始的任务并等待正在执行的任务结束
+ */
+class IoWorkerPool {
+   public:
+    explicit IoWorkerPool(size_t num_threads);
+
+    ~IoWorkerPool();
+
+    IoWorkerPool(const IoWorkerPool &) = delete;
+    IoWorkerPool &operator=(const IoWorkerPool &) = delete;
+
+    /**
+     * @description: 提交一个任务，由某个工作线程异步执行
+     * @param {function<void()>} task 要执行的任务
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @description: 等待所有已提交的任务执行完毕
+     */
+    void wait_idle();
+
+   private:
+    void worker_loop();
+
+    std::mutex latch_;
+    std::condition_variable cv_;        // 有新任务或需要退出时通知工作线程
+    std::condition_variable idle_cv_;   // 任务队列清空且没有正在执行的任务时通知等待者
+    std::deque<std::function<void()>> tasks_;
+    size_t running_ = 0;                // 正在执行的任务数
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
@@ -10,6 +10,12 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <shared_mutex>
+#include <string>
+
 #include "common/config.h"
 
 /**
@@ -21,7 +27,7 @@ struct PageId {
 
     friend bool operator==(const PageId &x, const PageId &y) { return x.fd == y.fd && x.page_no == y.page_no; }
     bool operator<(const PageId& x) const {
-        if(fd < x.fd) return true;
+        if (fd != x.fd) return fd < x.fd;
         return page_no < x.page_no;
     }
 
@@ -30,13 +36,24 @@ struct PageId {
     }
 
     inline int64_t Get() const {
-        return (static_cast<int64_t>(fd << 16) | page_no);
+        return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(fd)) << 32) |
+                                    static_cast<uint32_t>(page_no));
     }
 };
 
+// 64位整数的混合哈希(splitmix64的终结步骤)，fd和page_no的每一位都会影响结果的低位
+inline uint64_t hash_page_key(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
 // PageId的自定义哈希算法, 用于构建unordered_map<PageId, frame_id_t, PageIdHash>
 struct PageIdHash {
-    size_t operator()(const PageId &x) const { return (x.fd << 16) | x.page_no; }
+    size_t operator()(const PageId &x) const { return hash_page_key(static_cast<uint64_t>(x.Get())); }
 };
 
 template <>
@@ -46,17 +63,24 @@ struct std::hash<PageId> {
 
 /**
  * @description: Page类声明, Page是RMDB数据块的单位、是负责数据操作Record模块的操作对象，
- * Page对象在磁盘上有文件存储, 若在Buffer中则有帧偏移, 并非特指Buffer或Disk上的数据
+ * Page对象在磁盘上有文件存储, 若在Buffer中则有帧偏移, 并非特指Buffer或Disk上的数据。
+ * Page只是缓冲池中一个帧的描述符，页面数据保存在缓冲池按PAGE_SIZE对齐的数据区中，
+ * 描述符数组紧凑排列，扫描帧的元数据时不会访问页面数据所在的内存
  */
-class Page {
+class alignas(PAGE_DESC_ALIGN) Page {
     friend class BufferPoolManager;
+    friend class BufferPoolInstance;
+    friend struct FrameChunk;
 
    public:
     
-    Page() { reset_memory(); }
+    Page() = default;
 
     ~Page() = default;
 
+    Page(const Page &) = delete;
+    Page &operator=(const Page &) = delete;
+
     PageId get_page_id() const { return id_; }
 
     inline char *get_data() { return data_; }
@@ -71,6 +95,15 @@ class Page {
 
     inline void set_page_lsn(lsn_t page_lsn) { memcpy(get_data() + OFFSET_LSN, &page_lsn, sizeof(lsn_t)); }
 
+    /** 页面的读写锁，只能在页面被固定期间获取，一般通过ReadPageGuard/WritePageGuard使用 */
+    void RLatch() { latch_->lock_shared(); }
+
+    void RUnlatch() { latch_->unlock_shared(); }
+
+    void WLatch() { latch_->lock(); }
+
+    void WUnlatch() { latch_->unlock(); }
+
    private:
     void reset_memory() { memset(data_, OFFSET_PAGE_START, PAGE_SIZE); }  // 将data_的PAGE_SIZE个字节填充为0
 
@@ -78,13 +111,19 @@ class Page {
     PageId id_;
 
     /** The actual data that is stored within a page.
-     *  该页面在bufferPool中的偏移地址
+     *  该页面在缓冲池数据区中的地址，按PAGE_SIZE对齐，由BufferPoolInstance在构造时设置
      */
-    char data_[PAGE_SIZE] = {};
+    char *data_ = nullptr;
+
+    /** 该帧的读写锁，保存在BufferPoolInstance的锁数组中，保护页面数据 */
+    std::shared_mutex *latch_ = nullptr;
+
+    /** The pin count of this page. */
+    std::atomic<int> pin_count_{0};
 
     /** 脏页判断 */
     bool is_dirty_ = false;
 
-    /** The pin count of this page. */
-    int pin_count_ = 0;
-};
\ No newline at end of file
+    /** 无锁路径命中该页面的次数，pin_count_降为0时由缓冲池交给replacer。饱和在UINT8_MAX，不会回绕 */
+    std::atomic<uint8_t> hits_{0};
+};
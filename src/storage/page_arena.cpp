@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "page_arena.h"
+
+#include <sys/mman.h>
+
+#include "errors.h"
+
+namespace {
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+}
+
+PageArena::PageArena(size_t num_pages, bool use_huge_pages) {
+    size_ = num_pages * PAGE_SIZE;
+    void *addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (use_huge_pages && size_ >= HUGE_PAGE_SIZE) {
+        // 没有预留大页(/proc/sys/vm/nr_hugepages)时mmap失败，退化为普通页
+        size_t huge_size = (size_ + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        addr = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr != MAP_FAILED) {
+            size_ = huge_size;
+            huge_pages_ = true;
+        }
+    }
+#endif
+    if (addr == MAP_FAILED) {
+        addr = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            throw UnixError();
+        }
+#ifdef MADV_HUGEPAGE
+        if (use_huge_pages) {
+            madvise(addr, size_, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    // 匿名映射的内存已经清零，不需要再初始化
+    data_ = static_cast<char *>(addr);
+}
+
+PageArena::~PageArena() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
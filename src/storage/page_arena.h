@@ -0,0 +1,41 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/config.h"
+
+/**
+ * @description: 缓冲池的页面数据区。一次性用mmap申请pool_size * PAGE_SIZE字节的匿名内存，
+ * 每个帧的数据按PAGE_SIZE对齐，可以直接用于O_DIRECT读写。
+ * use_huge_pages为true时优先使用MAP_HUGETLB的2MB大页，失败时退化为普通页并通过madvise建议内核使用透明大页
+ */
+class PageArena {
+   public:
+    PageArena(size_t num_pages, bool use_huge_pages);
+
+    ~PageArena();
+
+    PageArena(const PageArena &) = delete;
+    PageArena &operator=(const PageArena &) = delete;
+
+    /** @return 第frame_id个帧的页面数据的起始地址 */
+    char *get_page(size_t frame_id) { return data_ + frame_id * PAGE_SIZE; }
+
+    /** @return 数据区是否由MAP_HUGETLB大页提供 */
+    bool is_huge_pages() const { return huge_pages_; }
+
+   private:
+    char *data_ = nullptr;
+    size_t size_ = 0;           // mmap的字节数，使用大页时向上取整到大页大小
+    bool huge_pages_ = false;
+};
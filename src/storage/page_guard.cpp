@@ -0,0 +1,73 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "page_guard.h"
+
+#include <utility>
+
+#include "buffer_pool_manager.h"
+
+ReadPageGuard::ReadPageGuard(ReadPageGuard &&other) noexcept
+    : buffer_pool_manager_(std::exchange(other.buffer_pool_manager_, nullptr)),
+      page_(std::exchange(other.page_, nullptr)) {}
+
+ReadPageGuard &ReadPageGuard::operator=(ReadPageGuard &&other) noexcept {
+    if (this != &other) {
+        drop();
+        buffer_pool_manager_ = std::exchange(other.buffer_pool_manager_, nullptr);
+        page_ = std::exchange(other.page_, nullptr);
+    }
+    return *this;
+}
+
+/**
+ * @description: 释放读锁并unpin页面，之后对象不再持有页面。可以重复调用
+ */
+void ReadPageGuard::drop() {
+    if (page_ == nullptr) {
+        return;
+    }
+    // 先释放读锁再unpin，unpin之后帧可能被淘汰并用于其他页面
+    PageId page_id = page_->get_page_id();
+    page_->RUnlatch();
+    buffer_pool_manager_->unpin_page(page_id, false);
+    page_ = nullptr;
+    buffer_pool_manager_ = nullptr;
+}
+
+WritePageGuard::WritePageGuard(WritePageGuard &&other) noexcept
+    : buffer_pool_manager_(std::exchange(other.buffer_pool_manager_, nullptr)),
+      page_(std::exchange(other.page_, nullptr)),
+      is_dirty_(std::exchange(other.is_dirty_, false)) {}
+
+WritePageGuard &WritePageGuard::operator=(WritePageGuard &&other) noexcept {
+    if (this != &other) {
+        drop();
+        buffer_pool_manager_ = std::exchange(other.buffer_pool_manager_, nullptr);
+        page_ = std::exchange(other.page_, nullptr);
+        is_dirty_ = std::exchange(other.is_dirty_, false);
+    }
+    return *this;
+}
+
+/**
+ * @description: 释放写锁并unpin页面，修改过的页面标记为脏页，之后对象不再持有页面。可以重复调用
+ */
+void WritePageGuard::drop() {
+    if (page_ == nullptr) {
+        return;
+    }
+    PageId page_id = page_->get_page_id();
+    page_->WUnlatch();
+    buffer_pool_manager_->unpin_page(page_id, is_dirty_);
+    page_ = nullptr;
+    buffer_pool_manager_ = nullptr;
+    is_dirty_ = false;
+}
@@ -0,0 +1,103 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "page.h"
+
+class BufferPoolManager;
+
+/**
+ * @description: 持有一个页面的读锁和固定的RAII对象，由BufferPoolManager::fetch_page_read返回。
+ * 析构或调用drop()时先释放读锁再unpin页面，不会标记为脏页。只能移动，不能复制；
+ * 获取页面失败时返回的对象不持有页面，is_valid()为false
+ */
+class ReadPageGuard {
+   public:
+    ReadPageGuard() = default;
+
+    /**
+     * @description: 接管一个已经被固定并持有读锁的页面
+     */
+    ReadPageGuard(BufferPoolManager *buffer_pool_manager, Page *page)
+        : buffer_pool_manager_(buffer_pool_manager), page_(page) {}
+
+    ReadPageGuard(ReadPageGuard &&other) noexcept;
+
+    ReadPageGuard &operator=(ReadPageGuard &&other) noexcept;
+
+    ReadPageGuard(const ReadPageGuard &) = delete;
+    ReadPageGuard &operator=(const ReadPageGuard &) = delete;
+
+    ~ReadPageGuard() { drop(); }
+
+    void drop();
+
+    bool is_valid() const { return page_ != nullptr; }
+
+    PageId get_page_id() const { return page_->get_page_id(); }
+
+    /** 持有读锁期间不能修改页面数据 */
+    Page *get_page() const { return page_; }
+
+    const char *get_data() const { return page_->get_data(); }
+
+   private:
+    BufferPoolManager *buffer_pool_manager_ = nullptr;
+    Page *page_ = nullptr;
+};
+
+/**
+ * @description: 持有一个页面的写锁和固定的RAII对象，由BufferPoolManager::fetch_page_write返回。
+ * 通过get_data_mut()或mark_dirty()修改过页面时，释放时将页面标记为脏页
+ */
+class WritePageGuard {
+    friend class BufferPoolManager;
+
+   public:
+    WritePageGuard() = default;
+
+    /**
+     * @description: 接管一个已经被固定并持有写锁的页面
+     */
+    WritePageGuard(BufferPoolManager *buffer_pool_manager, Page *page)
+        : buffer_pool_manager_(buffer_pool_manager), page_(page) {}
+
+    WritePageGuard(WritePageGuard &&other) noexcept;
+
+    WritePageGuard &operator=(WritePageGuard &&other) noexcept;
+
+    WritePageGuard(const WritePageGuard &) = delete;
+    WritePageGuard &operator=(const WritePageGuard &) = delete;
+
+    ~WritePageGuard() { drop(); }
+
+    void drop();
+
+    bool is_valid() const { return page_ != nullptr; }
+
+    PageId get_page_id() const { return page_->get_page_id(); }
+
+    Page *get_page() const { return page_; }
+
+    const char *get_data() const { return page_->get_data(); }
+
+    char *get_data_mut() {
+        is_dirty_ = true;
+        return page_->get_data();
+    }
+
+    void mark_dirty() { is_dirty_ = true; }
+
+   private:
+    BufferPoolManager *buffer_pool_manager_ = nullptr;
+    Page *page_ = nullptr;
+    bool is_dirty_ = false;
+};
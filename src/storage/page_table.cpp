@@ -0,0 +1,193 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "page_table.h"
+
+#include <cassert>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+PageTable::PageTable(size_t max_entries) {
+    tables_.push_back(std::make_unique<Table>(capacity_for(max_entries)));
+    table_.store(tables_.back().get());
+}
+
+size_t PageTable::capacity_for(size_t max_entries) {
+    size_t capacity = 16;
+    while (capacity < 2 * max_entries) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+/**
+ * @description: 等待写者结束修改时的退避。前几次用CPU的pause指令自旋，降低对版本号所在缓存行的争用；
+ *              写者长时间没有结束(例如正在扩容)时让出CPU
+ * @param {int} spins 已经重试的次数
+ */
+static void backoff(int spins) {
+    if (spins < PAGE_TABLE_SPIN_LIMIT) {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#endif
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @description: 查找页面所在的帧，不需要持有分区的互斥锁。与修改并发时重试，直到读到一致的结果
+ * @return {bool} 页面在表中则返回true
+ * @param {PageId} page_id 目标页面
+ * @param {frame_id_t*} frame_id 返回页面所在的帧编号
+ */
+bool PageTable::find(PageId page_id, frame_id_t *frame_id) const {
+    uint64_t key = make_key(page_id);
+    for (int spins = 0;; spins++) {
+        uint64_t version = version_.load();
+        if (version & 1) {
+            backoff(spins);
+            continue;
+        }
+        // 扩容期间读到的旧表不会被释放，版本号检查保证结果来自一致的表
+        const Table *table = table_.load(std::memory_order_acquire);
+        bool found = false;
+        frame_id_t result = INVALID_FRAME_ID;
+        // 装载因子不超过1/2，表中总有空位，探测一定会结束
+        for (size_t i = table->home_slot(key), probes = 0; probes <= table->mask;
+             i = (i + 1) & table->mask, probes++) {
+            uint64_t slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == EMPTY_KEY) {
+                break;
+            }
+            if (slot_key == key) {
+                result = table->slots[i].frame_id.load(std::memory_order_relaxed);
+                found = true;
+                break;
+            }
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (version_.load() == version) {
+            *frame_id = result;
+            return found;
+        }
+    }
+}
+
+/**
+ * @description: 插入一个映射，调用者需持有分区的互斥锁，且page_id不在表中
+ * @param {PageId} page_id 页面
+ * @param {frame_id_t} frame_id 页面所在的帧编号
+ */
+void PageTable::insert(PageId page_id, frame_id_t frame_id) {
+    assert(2 * (size_ + 1) <= capacity());
+    uint64_t key = make_key(page_id);
+    Table *table = table_.load(std::memory_order_relaxed);
+    begin_write();
+    size_t i = table->home_slot(key);
+    while (table->slots[i].key.load(std::memory_order_relaxed) != EMPTY_KEY) {
+        i = (i + 1) & table->mask;
+    }
+    table->slots[i].frame_id.store(frame_id, std::memory_order_relaxed);
+    table->slots[i].key.store(key, std::memory_order_release);
+    size_++;
+    end_write();
+}
+
+/**
+ * @description: 删除一个映射，调用者需持有分区的互斥锁。
+ *              删除后把同一探测链上后面的表项依次前移填补空位(backward shift deletion)
+ * @return {bool} page_id在表中则返回true
+ * @param {PageId} page_id 页面
+ */
+bool PageTable::erase(PageId page_id) {
+    uint64_t key = make_key(page_id);
+    Table *table = table_.load(std::memory_order_relaxed);
+    Slot *slots = table->slots.get();
+    size_t mask = table->mask;
+    size_t i = table->home_slot(key);
+    while (true) {
+        uint64_t slot_key = slots[i].key.load(std::memory_order_relaxed);
+        if (slot_key == EMPTY_KEY) {
+            return false;
+        }
+        if (slot_key == key) {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+    begin_write();
+    size_t hole = i;
+    for (size_t j = (hole + 1) & mask;; j = (j + 1) & mask) {
+        uint64_t slot_key = slots[j].key.load(std::memory_order_relaxed);
+        if (slot_key == EMPTY_KEY) {
+            break;
+        }
+        // 表项j的起始位置不在(hole, j]之间时，把它移到空位上不会使它脱离探测链
+        size_t home = table->home_slot(slot_key);
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            slots[hole].frame_id.store(slots[j].frame_id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            slots[hole].key.store(slot_key, std::memory_order_relaxed);
+            hole = j;
+        }
+    }
+    slots[hole].key.store(EMPTY_KEY, std::memory_order_relaxed);
+    slots[hole].frame_id.store(INVALID_FRAME_ID, std::memory_order_relaxed);
+    size_--;
+    end_write();
+    return true;
+}
+
+/**
+ * @description: 保证表中可以容纳max_entries个映射，容量不足时分配更大的表并重新插入所有映射。
+ *              调用者需持有分区的互斥锁；重新插入期间版本号为奇数，并发的查找会等待新表发布后重试
+ * @param {size_t} max_entries 表中最多同时存在的映射个数
+ */
+void PageTable::reserve(size_t max_entries) {
+    size_t capacity = capacity_for(max_entries);
+    Table *old_table = table_.load(std::memory_order_relaxed);
+    if (capacity <= old_table->mask + 1) {
+        return;
+    }
+    auto new_table = std::make_unique<Table>(capacity);
+    for (size_t i = 0; i <= old_table->mask; i++) {
+        uint64_t key = old_table->slots[i].key.load(std::memory_order_relaxed);
+        if (key == EMPTY_KEY) {
+            continue;
+        }
+        size_t j = new_table->home_slot(key);
+        while (new_table->slots[j].key.load(std::memory_order_relaxed) != EMPTY_KEY) {
+            j = (j + 1) & new_table->mask;
+        }
+        new_table->slots[j].frame_id.store(old_table->slots[i].frame_id.load(std::memory_order_relaxed),
+                                           std::memory_order_relaxed);
+        new_table->slots[j].key.store(key, std::memory_order_relaxed);
+    }
+    begin_write();
+    table_.store(new_table.get(), std::memory_order_release);
+    tables_.push_back(std::move(new_table));
+    end_write();
+}
+
+/**
+ * @description: 开始修改，版本号变为奇数。release栅栏保证读者看到任何修改时也能看到奇数版本号
+ */
+void PageTable::begin_write() {
+    version_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * @description: 结束修改，版本号变回偶数
+ */
+void PageTable::end_write() { version_.fetch_add(1); }
@@ -0,0 +1,79 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/config.h"
+#include "page.h"
+
+/**
+ * @description: 缓冲池分区的页表，记录PageId到帧编号的映射。
+ * 采用线性探测的开放寻址哈希表，容量按帧数确定(不小于帧数的两倍且为2的幂)，缓冲池扩容时由reserve扩大，不会缩小。
+ * 修改操作(insert/erase)由调用者持有分区的互斥锁串行执行；查找不加锁，
+ * 通过版本号乐观读取：修改期间版本号为奇数，查找前后版本号不一致时重试。
+ * 删除时把后面的表项向前移动填补空位，表中没有墓碑，探测长度不会随着淘汰次数增长
+ */
+class PageTable {
+   public:
+    /**
+     * @param {size_t} max_entries 表中最多同时存在的映射个数，即分区的帧数
+     */
+    explicit PageTable(size_t max_entries);
+
+    PageTable(const PageTable &) = delete;
+    PageTable &operator=(const PageTable &) = delete;
+
+    bool find(PageId page_id, frame_id_t *frame_id) const;
+
+    void insert(PageId page_id, frame_id_t frame_id);
+
+    bool erase(PageId page_id);
+
+    void reserve(size_t max_entries);
+
+    size_t size() const { return size_; }
+
+    size_t capacity() const { return table_.load(std::memory_order_relaxed)->mask + 1; }
+
+   private:
+    static constexpr uint64_t EMPTY_KEY = ~0ULL;
+
+    struct alignas(16) Slot {
+        std::atomic<uint64_t> key{EMPTY_KEY};
+        std::atomic<frame_id_t> frame_id{INVALID_FRAME_ID};
+    };
+
+    static uint64_t make_key(PageId page_id) { return static_cast<uint64_t>(page_id.Get()); }
+
+    struct Table {
+        explicit Table(size_t capacity) : slots(std::make_unique<Slot[]>(capacity)), mask(capacity - 1) {}
+
+        size_t home_slot(uint64_t key) const { return hash_page_key(key) & mask; }
+
+        std::unique_ptr<Slot[]> slots;
+        size_t mask;                        // 容量减一，容量为2的幂
+    };
+
+    static size_t capacity_for(size_t max_entries);
+
+    void begin_write();
+
+    void end_write();
+
+    std::atomic<Table *> table_;            // 当前使用的哈希表
+    std::vector<std::unique_ptr<Table>> tables_;    // 分配过的所有哈希表，扩容前的旧表可能还在被查找读取，析构时才释放
+    size_t size_ = 0;                       // 当前的映射个数，只由修改者访问
+    std::atomic<uint64_t> version_{0};      // 修改期间为奇数
+};
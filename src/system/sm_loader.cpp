@@ -0,0 +1,264 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "sm_manager.h"
+
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <thread>
+
+#include "record/rm.h"
+
+namespace {
+
+constexpr size_t LOAD_CHUNK_SIZE = 1 << 20;  // 每个解析任务处理的数据量，实际大小会补齐到行尾
+constexpr unsigned LOAD_MAX_WORKERS = 8;     // 同时解析的数据块数量上限
+
+/* 一个数据块的解析结果 */
+struct ParsedChunk {
+    std::vector<char> records;  // 解析出的定长记录，依次存放
+    int num_records = 0;
+    int num_lines = 0;          // 数据块包含的行数，用于计算出错位置在文件中的行号
+    int error_line = -1;        // 出错的行在数据块中的行号（从0开始），-1表示没有出错
+    std::string error;
+};
+
+/**
+ * @description: 把一行按逗号拆分成字段。字段可以用双引号包围，其中的逗号不作为分隔符，两个连续的双引号表示一个双引号；
+ *              数据块按换行切分，因此字段中不能包含换行
+ */
+void split_csv_line(const char* begin, const char* end, std::vector<std::string>* fields) {
+    fields->clear();
+    const char* p = begin;
+    while (true) {
+        std::string field;
+        if (p < end && *p == '"') {
+            for (p++; p < end; p++) {
+                if (*p != '"') {
+                    field.push_back(*p);
+                } else if (p + 1 < end && p[1] == '"') {
+                    field.push_back('"');
+                    p++;
+                } else {
+                    p++;
+                    break;
+                }
+            }
+            while (p < end && *p != ',') {
+                p++;
+            }
+        } else {
+            const char* q = static_cast<const char*>(memchr(p, ',', end - p));
+            q = q == nullptr ? end : q;
+            field.assign(p, q);
+            p = q;
+        }
+        fields->push_back(std::move(field));
+        if (p >= end) {
+            break;
+        }
+        p++;
+    }
+}
+
+/**
+ * @description: 按列的类型把一个字段写入记录中该列的位置
+ * @return {bool} 字段的值是否合法，不合法时error为出错原因
+ */
+bool parse_field(const std::string& field, const ColMeta& col, char* dest, std::string* error) {
+    if (col.type == TYPE_INT || col.type == TYPE_FLOAT) {
+        const char* begin = field.c_str();
+        char* end = nullptr;
+        errno = 0;
+        bool ok;
+        if (col.type == TYPE_INT) {
+            long val = std::strtol(begin, &end, 10);
+            ok = errno != ERANGE && val >= INT_MIN && val <= INT_MAX;
+            int int_val = static_cast<int>(val);
+            memcpy(dest, &int_val, sizeof(int));
+        } else {
+            float val = std::strtof(begin, &end);
+            ok = errno != ERANGE && std::isfinite(val);
+            memcpy(dest, &val, sizeof(float));
+        }
+        while (*end == ' ' || *end == '\t') {
+            end++;
+        }
+        if (!ok || end == begin || *end != '\0') {
+            *error = "invalid " + coltype2str(col.type) + " value '" + field + "' for column " + col.name;
+            return false;
+        }
+        return true;
+    }
+    if (static_cast<int>(field.size()) > col.len) {
+        *error = "value of column " + col.name + " is longer than " + std::to_string(col.len);
+        return false;
+    }
+    memset(dest, 0, col.len);
+    memcpy(dest, field.data(), field.size());
+    return true;
+}
+
+/**
+ * @description: 解析一个按行对齐的数据块，空行被跳过，遇到第一个错误时停止
+ */
+ParsedChunk parse_chunk(std::string chunk, const std::vector<ColMeta>& cols, int record_size) {
+    ParsedChunk parsed;
+    std::vector<std::string> fields;
+    const char* p = chunk.data();
+    const char* end = p + chunk.size();
+    while (p < end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        eol = eol == nullptr ? end : eol;
+        const char* line_end = eol > p && eol[-1] == '\r' ? eol - 1 : eol;
+        int line = parsed.num_lines++;
+        if (line_end > p) {
+            split_csv_line(p, line_end, &fields);
+            if (fields.size() != cols.size()) {
+                parsed.error_line = line;
+                parsed.error = "expect " + std::to_string(cols.size()) + " fields, got " + std::to_string(fields.size());
+                return parsed;
+            }
+            parsed.records.resize(static_cast<size_t>(parsed.num_records + 1) * record_size);
+            char* rec = parsed.records.data() + static_cast<size_t>(parsed.num_records) * record_size;
+            for (size_t i = 0; i < cols.size(); i++) {
+                if (!parse_field(fields[i], cols[i], rec + cols[i].offset, &parsed.error)) {
+                    parsed.error_line = line;
+                    return parsed;
+                }
+            }
+            parsed.num_records++;
+        }
+        p = eol + 1;
+    }
+    return parsed;
+}
+
+/**
+ * @description: 从文件中读出下一个数据块追加到chunk后面，数据块补齐到行尾，保证每一行完整地落在一个数据块中
+ * @return {bool} chunk是否非空
+ */
+bool read_chunk(std::ifstream& in, std::string* chunk) {
+    size_t prefix = chunk->size();
+    chunk->resize(prefix + LOAD_CHUNK_SIZE);
+    in.read(&(*chunk)[prefix], LOAD_CHUNK_SIZE);
+    chunk->resize(prefix + in.gcount());
+    std::string rest;
+    if (!chunk->empty() && chunk->back() != '\n' && std::getline(in, rest)) {
+        chunk->append(rest);
+        chunk->push_back('\n');
+    }
+    return !chunk->empty();
+}
+
+/** @return 一行的字段是否依次等于表的列名 */
+bool is_header(const std::string& line, const std::vector<ColMeta>& cols) {
+    std::vector<std::string> fields;
+    const char* end = line.data() + line.size();
+    if (!line.empty() && line.back() == '\r') {
+        end--;
+    }
+    split_csv_line(line.data(), end, &fields);
+    if (fields.size() != cols.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < cols.size(); i++) {
+        if (fields[i] != cols[i].name) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+/**
+ * @description: 从CSV文件批量导入数据，由LOAD DATA语句调用。每行一条记录，字段按表的列顺序用逗号分隔，
+ *              第一行与列名相同时视为表头跳过。文件按行对齐切成数据块，由多个线程并行解析，
+ *              解析结果按原顺序整块写入记录文件，每个页面只pin一次，返回前把记录文件写回磁盘。
+ *              导入不写逐行的日志，也不加入事务的写集合，出错时删除已经导入的记录后抛出LoadDataError。
+ *              B+树的插入还没有实现，有索引的表直接拒绝导入，避免导入的记录在索引中缺失
+ * @param {string&} file_name CSV文件的路径
+ * @param {string&} tab_name 导入的表
+ * @param {Context*} context
+ * @return {size_t} 导入的记录数
+ */
+size_t SmManager::load_data(const std::string& file_name, const std::string& tab_name, Context* context) {
+    TabMeta& tab = db_.get_table(tab_name);
+    if (!tab.indexes.empty()) {
+        throw LoadIndexedTableError(tab_name);
+    }
+    RmFileHandle* fh = fhs_.at(tab_name).get();
+    int record_size = fh->get_file_hdr().record_size;
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in.is_open()) {
+        throw FileNotFoundError(file_name);
+    }
+
+    // 第一行是表头时跳过，否则作为第一个数据块的开头
+    std::string chunk;
+    int line_base = 0;
+    if (std::getline(in, chunk)) {
+        if (is_header(chunk, tab.cols)) {
+            chunk.clear();
+            line_base = 1;
+        } else {
+            chunk.push_back('\n');
+        }
+    }
+
+    size_t max_pending = std::max(1u, std::min(LOAD_MAX_WORKERS, std::thread::hardware_concurrency()));
+    std::deque<std::future<ParsedChunk>> pending;
+    std::vector<Rid> rids;
+    bool eof = false;
+    try {
+        while (true) {
+            // 始终保持max_pending个数据块在后台解析，写入当前数据块时后面的数据块继续解析
+            while (!eof && pending.size() < max_pending) {
+                if (!read_chunk(in, &chunk)) {
+                    eof = true;
+                    break;
+                }
+                pending.push_back(
+                    std::async(std::launch::async, parse_chunk, std::move(chunk), std::cref(tab.cols), record_size));
+                chunk.clear();
+            }
+            if (pending.empty()) {
+                break;
+            }
+            ParsedChunk parsed = pending.front().get();
+            pending.pop_front();
+            if (parsed.error_line >= 0) {
+                throw LoadDataError(file_name, line_base + parsed.error_line + 1, parsed.error);
+            }
+            line_base += parsed.num_lines;
+
+            // 插入中途出错时，这个数据块中已经插入的记录也追加在rids中，随后被删除
+            fh->insert_records(parsed.records.data(), parsed.num_records, &rids, context);
+        }
+    } catch (...) {
+        // 等待后台的解析任务结束，再删除已经导入的记录
+        pending.clear();
+        for (auto it = rids.rbegin(); it != rids.rend(); ++it) {
+            fh->delete_record(*it, context);
+        }
+        throw;
+    }
+
+    // 导入不写日志，写回磁盘之后才返回
+    rm_manager_->flush_file(fh);
+    return rids.size();
+}
@@ -13,7 +13,14 @@ See the Mulan PSL v2 for more details. */
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 
 #include "index/ix.h"
 #include "record/rm.h"
@@ -87,9 +94,13 @@ void SmManager::drop_db(const std::string& db_name) {
 void SmManager::open_db(const std::string& db_name) {
     // 进入名为db_name的目录
     chdir(db_name.c_str());
-    // 加载DB元数据
-    std::ifstream ifs(DB_META_NAME);
-    ifs >> db_;
+    // 加载DB元数据，读完后立即关闭。预热按文件名把保存的页面对应到新的文件句柄，句柄变化不影响正确性；
+    // 但缓冲池按(文件句柄, 页面号)划分分区，数据文件得到与上次相同的句柄时，页面的分区分布与保存时相同，
+    // 保存的页面都能放下，不会在预热时互相换出
+    {
+        std::ifstream ifs(DB_META_NAME);
+        ifs >> db_;
+    }
 
     // 加载数据库相关文件
     for (auto& entry : db_.tabs_) {
@@ -102,6 +113,9 @@ void SmManager::open_db(const std::string& db_name) {
                          ix_manager_->open_index(tab_name, index.cols));
         }
     }
+    // 在后台读入上次关闭时缓冲池中的页面
+    load_buffer_pool();
+    start_dump_thread();
 }
 
 /**
@@ -117,8 +131,21 @@ void SmManager::flush_meta() {
  * @description: 关闭数据库并把数据落盘
  */
 void SmManager::close_db() {
+    // 保存缓冲池中的页面列表，必须在关闭文件之前完成
+    stop_dump_thread();
+    dump_buffer_pool();
     // 将数据库输入刷入磁盘中
     flush_meta();
+    // 按页号顺序合并写回所有文件的脏页，关闭文件时不再有脏页需要写回
+    auto start = std::chrono::steady_clock::now();
+    FlushStats stats = flush_all_files();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Flushed " << stats.num_pages << " pages (" << stats.num_bytes << " bytes) in " << stats.num_writes
+              << " writes, " << elapsed.count() << " ms\n";
+    // 关闭文件之前保存最后一次I/O统计
+    if (METRICS_DUMP_INTERVAL_SEC > 0) {
+        dump_metrics();
+    }
     // 关闭表数据文件
     for (auto& entry : fhs_) {
         const RmFileHandle* file_handle = entry.second.get();
@@ -142,6 +169,41 @@ void SmManager::close_db() {
     }
 }
 
+/**
+ * @description: 把所有打开的表和索引文件在缓冲池中的脏页和文件头写回磁盘，关闭数据库和检查点时调用
+ * @return {FlushStats} 写回的页面数、字节数和写请求数
+ */
+FlushStats SmManager::flush_all_files() {
+    FlushStats stats;
+    for (auto& entry : fhs_) {
+        stats += rm_manager_->flush_file(entry.second.get());
+    }
+    for (auto& entry : ihs_) {
+        stats += ix_manager_->flush_index(entry.second.get());
+    }
+    return stats;
+}
+
+/**
+ * @description: 检查点：写回元数据和所有文件的脏页，把写回的统计输出给客户端。调用者需要先把日志刷入磁盘
+ * @param {Context*} context
+ */
+void SmManager::checkpoint(Context* context) {
+    flush_meta();
+    auto start = std::chrono::steady_clock::now();
+    FlushStats stats = flush_all_files();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    RecordPrinter printer(4);
+    printer.print_separator(context);
+    printer.print_record({"Pages", "Bytes", "Writes", "Time(ms)"}, context);
+    printer.print_separator(context);
+    printer.print_record({std::to_string(stats.num_pages), std::to_string(stats.num_bytes),
+                          std::to_string(stats.num_writes), std::to_string(elapsed.count())},
+                         context);
+    printer.print_separator(context);
+}
+
 /**
  * @description: 显示所有的表,通过测试需要将其结果写入到output.txt,详情看题目文档
  * @param {Context*} context
@@ -163,6 +225,95 @@ void SmManager::show_tables(Context* context) {
     outfile.close();
 }
 
+namespace {
+
+std::string format_ratio(double ratio) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << ratio * 100 << "%";
+    return oss.str();
+}
+
+uint64_t average(uint64_t sum, uint64_t count) { return count == 0 ? 0 : sum / count; }
+
+/** @return I/O统计的各项名称和取值，SHOW BUFFER STATUS和metrics文件使用相同的名称 */
+std::vector<std::pair<std::string, std::string>> io_stats_fields(const FileIoStats& stats) {
+    return {{"hits", std::to_string(stats.fetch_hits)},
+            {"misses", std::to_string(stats.fetch_misses)},
+            {"hit_ratio", format_ratio(stats.hit_ratio())},
+            {"evictions", std::to_string(stats.evictions)},
+            {"dirty_writebacks", std::to_string(stats.dirty_writebacks)},
+            {"flushed_pages", std::to_string(stats.flushed_pages)},
+            {"reads", std::to_string(stats.num_reads)},
+            {"bytes_read", std::to_string(stats.bytes_read)},
+            {"avg_read_us", std::to_string(average(stats.read_time_us, stats.num_reads))},
+            {"writes", std::to_string(stats.num_writes)},
+            {"bytes_written", std::to_string(stats.bytes_written)},
+            {"avg_write_us", std::to_string(average(stats.write_time_us, stats.num_writes))}};
+}
+
+/** @return 延迟分布的样本数、平均值和分位数 */
+std::vector<std::pair<std::string, std::string>> latency_fields(const LatencyHistogram& histogram) {
+    return {{"count", std::to_string(histogram.count())},
+            {"avg_us", std::to_string(average(histogram.sum_us(), histogram.count()))},
+            {"p50_us", std::to_string(histogram.percentile_us(0.5))},
+            {"p99_us", std::to_string(histogram.percentile_us(0.99))}};
+}
+
+}  // namespace
+
+/**
+ * @description: 显示缓冲池和磁盘I/O的统计，由SHOW BUFFER STATUS语句调用。
+ *              依次输出全局统计、每个打开文件的统计和延迟分布，延迟的分位数为所在2的幂区间的上界
+ * @param {Context*} context
+ */
+void SmManager::show_buffer_status(Context* context) {
+    auto total = io_stats_fields(disk_manager_->get_total_io_stats());
+    RecordPrinter printer(2);
+    printer.print_separator(context);
+    printer.print_record({"Metric", "Value"}, context);
+    printer.print_separator(context);
+    printer.print_record({"pool_size", std::to_string(buffer_pool_manager_->get_pool_size())}, context);
+    printer.print_record({"bg_flushed_pages", std::to_string(buffer_pool_manager_->get_bg_flushed_pages())}, context);
+    for (auto& [name, value] : total) {
+        printer.print_record({name, value}, context);
+    }
+    printer.print_separator(context);
+
+    std::vector<std::string> captions = {"file"};
+    for (auto& field : total) {
+        captions.push_back(field.first);
+    }
+    RecordPrinter file_printer(captions.size());
+    file_printer.print_separator(context);
+    file_printer.print_record(captions, context);
+    file_printer.print_separator(context);
+    for (auto& [fd, path] : disk_manager_->list_open_files()) {
+        std::vector<std::string> row = {path};
+        for (auto& field : io_stats_fields(disk_manager_->get_file_io_stats(fd))) {
+            row.push_back(field.second);
+        }
+        file_printer.print_record(row, context);
+    }
+    file_printer.print_separator(context);
+
+    const IoStats& io_stats = disk_manager_->get_io_stats();
+    std::vector<std::pair<std::string, const LatencyHistogram*>> histograms = {
+        {"disk_read", &io_stats.read_latency}, {"disk_write", &io_stats.write_latency},
+        {"fetch_miss", &io_stats.miss_latency}};
+    RecordPrinter latency_printer(5);
+    latency_printer.print_separator(context);
+    latency_printer.print_record({"latency", "count", "avg_us", "p50_us", "p99_us"}, context);
+    latency_printer.print_separator(context);
+    for (auto& [name, histogram] : histograms) {
+        std::vector<std::string> row = {name};
+        for (auto& field : latency_fields(*histogram)) {
+            row.push_back(field.second);
+        }
+        latency_printer.print_record(row, context);
+    }
+    latency_printer.print_separator(context);
+}
+
 /**
  * @description: 显示表的元数据
  * @param {string&} tab_name 表名称
@@ -193,6 +344,18 @@ void SmManager::desc_table(const std::string& tab_name, Context* context) {
  * @param {Context*} context
  */
 void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context) {
+    create_table(tab_name, col_defs, "", context);
+}
+
+/**
+ * @description: 创建表，并指定表数据文件的页面格式
+ * @param {string&} tab_name 表的名称
+ * @param {vector<ColDef>&} col_defs 表的字段
+ * @param {string&} storage 页面格式，BITMAP、SLOTTED或PAX（不区分大小写）；为空时有VARCHAR字段的表使用SLOTTED，否则使用BITMAP
+ * @param {Context*} context
+ */
+void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs,
+                             const std::string& storage, Context* context) {
     if (db_.is_table(tab_name)) {
         throw TableExistsError(tab_name);
     }
@@ -200,6 +363,9 @@ void SmManager::create_table(const std::string& tab_name, const std::vector<ColD
     int curr_offset = 0;
     TabMeta tab;
     tab.name = tab_name;
+    std::vector<RmVarCol> var_cols;
+    std::vector<RmVarCol> all_cols;
+    std::vector<RmZoneCol> zone_cols;  // 所有字段都是维护页面摘要的候选，过长的字符串字段由record层忽略
     for (auto& col_def : col_defs) {
         ColMeta col = {.tab_name = tab_name,
                        .name = col_def.name,
@@ -207,12 +373,32 @@ void SmManager::create_table(const std::string& tab_name, const std::vector<ColD
                        .len = col_def.len,
                        .offset = curr_offset,
                        .index = false};
+        if (col.type == TYPE_VARCHAR) {
+            var_cols.push_back(RmVarCol{static_cast<uint16_t>(col.offset), static_cast<uint16_t>(col.len)});
+        }
+        all_cols.push_back(RmVarCol{static_cast<uint16_t>(col.offset), static_cast<uint16_t>(col.len)});
+        zone_cols.push_back(RmZoneCol{static_cast<uint16_t>(col.offset), static_cast<uint16_t>(col.len), col.type});
         curr_offset += col_def.len;
         tab.cols.push_back(col);
     }
+    RmFileFormat format = var_cols.empty() ? RM_FORMAT_BITMAP : RM_FORMAT_SLOTTED;
+    if (!storage.empty()) {
+        std::string name = storage;
+        std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+        if (name == "BITMAP") {
+            format = RM_FORMAT_BITMAP;
+        } else if (name == "SLOTTED") {
+            format = RM_FORMAT_SLOTTED;
+        } else if (name == "PAX") {
+            format = RM_FORMAT_PAX;
+        } else {
+            throw UnknownStorageFormatError(storage);
+        }
+    }
     // Create & open record file
     int record_size = curr_offset;  // record_size就是col meta所占的大小（表的元数据也是以记录的形式进行存储的）
-    rm_manager_->create_file(tab_name, record_size);
+    // PAX格式按最大长度存放VARCHAR字段，每个字段一个minipage
+    rm_manager_->create_file(tab_name, record_size, format, format == RM_FORMAT_PAX ? all_cols : var_cols, zone_cols);
     db_.tabs_[tab_name] = tab;
     // fhs_[tab_name] = rm_manager_->open_file(tab_name);
     fhs_.emplace(tab_name, rm_manager_->open_file(tab_name));
@@ -303,4 +489,204 @@ void SmManager::drop_index(const std::string& tab_name, const std::vector<std::s
     // 更新indexes
     auto idx_meta = db_.get_table(tab_name).get_index_meta(col_names);
     db_.get_table(tab_name).indexes.erase(idx_meta);
-}
\ No newline at end of file
+}
+
+/**
+ * @description: 修改一个运行时参数，由SET knob_name = value语句调用
+ *              bg_flush_rate: 后台刷脏线程每秒最多写回的页面数，0表示暂停后台刷脏
+ *              bg_clean_ratio: replacer尾部应当保持干净的帧的比例，取值范围[0, 1]
+ *              buffer_pool_size: 缓冲池可容纳的页面数，在线扩容或缩容，按chunk取整，缩容遇到被固定的页面时提前停止
+ * @param {string&} knob_name 参数名称
+ * @param {Value&} value 参数的新值
+ * @param {Context*} context
+ */
+void SmManager::set_knob(const std::string& knob_name, const Value& value, Context* context) {
+    if (knob_name == "bg_flush_rate") {
+        if (value.type != TYPE_INT || value.int_val < 0) {
+            throw InvalidKnobValueError(knob_name, "expect a non-negative integer");
+        }
+        buffer_pool_manager_->set_bg_flush_rate(value.int_val);
+    } else if (knob_name == "bg_clean_ratio") {
+        double ratio = value.type == TYPE_INT ? value.int_val : value.type == TYPE_FLOAT ? value.float_val : -1;
+        if (ratio < 0 || ratio > 1) {
+            throw InvalidKnobValueError(knob_name, "expect a number between 0 and 1");
+        }
+        buffer_pool_manager_->set_bg_clean_ratio(ratio);
+    } else if (knob_name == "buffer_pool_size") {
+        if (value.type != TYPE_INT || value.int_val <= 0) {
+            throw InvalidKnobValueError(knob_name, "expect a positive integer");
+        }
+        buffer_pool_manager_->resize(value.int_val);
+    } else {
+        throw UnknownKnobError(knob_name);
+    }
+}
+
+/**
+ * @description: 整理表的数据文件，由VACUUM语句调用。记录从文件末尾的页面逐页移到前面有空闲空间的页面，
+ *              最后截断文件末尾清空的页面并写回文件头。
+ *              整理期间表可以照常读取，只有正在整理的页面与顺序扫描互斥。
+ *              移动不写日志（日志管理器和恢复尚未实现），由RmFileHandle::vacuum_page先把目标页面写回磁盘保证记录不丢失。
+ *              与LOAD DATA相同，B+树的插入和删除还没有实现，有索引的表直接拒绝整理，避免索引中留下指向旧位置的Rid
+ * @param {string&} tab_name 表的名称
+ * @param {Context*} context
+ * @return {int} 移动的记录数
+ */
+int SmManager::vacuum_table(const std::string& tab_name, Context* context) {
+    TabMeta& tab = db_.get_table(tab_name);
+    if (!tab.indexes.empty()) {
+        throw VacuumIndexedTableError(tab_name);
+    }
+    RmFileHandle* fh = fhs_.at(tab_name).get();
+    // 表没有索引，移动记录时不需要更新其他结构
+    int num_moved = fh->vacuum([](const Rid&, const Rid&, const char*) {});
+    rm_manager_->flush_file(fh);
+    return num_moved;
+}
+
+/**
+ * @description: 把缓冲池中的页面列表保存到BUFFER_POOL_DUMP_NAME文件中，每行为"文件名 页面号"，最近被访问的页面在前。
+ *              文件句柄在重启后会变化，因此保存文件名。先写入临时文件再重命名，避免崩溃时留下不完整的列表
+ */
+void SmManager::dump_buffer_pool() {
+    std::vector<PageId> page_ids = buffer_pool_manager_->get_resident_pages();
+    std::unordered_map<int, std::string> fd2name;
+    std::string tmp_name = BUFFER_POOL_DUMP_NAME + ".tmp";
+    std::ofstream ofs(tmp_name);
+    for (auto& page_id : page_ids) {
+        auto pos = fd2name.find(page_id.fd);
+        if (pos == fd2name.end()) {
+            std::string name;
+            try {
+                name = disk_manager_->get_file_name(page_id.fd);
+            } catch (FileNotOpenError&) {
+                // 文件已经被关闭，其页面不需要预热
+            }
+            pos = fd2name.emplace(page_id.fd, name).first;
+        }
+        if (!pos->second.empty()) {
+            ofs << pos->second << ' ' << page_id.page_no << '\n';
+        }
+    }
+    ofs.close();
+    if (rename(tmp_name.c_str(), BUFFER_POOL_DUMP_NAME.c_str()) < 0) {
+        throw UnixError();
+    }
+}
+
+/**
+ * @description: 读取BUFFER_POOL_DUMP_NAME中保存的页面列表，在后台把最近被访问的页面重新读入缓冲池。
+ *              最多读入缓冲池大小个页面，按照(文件, 页面号)排序后合并为连续的区间批量预读
+ */
+void SmManager::load_buffer_pool() {
+    std::ifstream ifs(BUFFER_POOL_DUMP_NAME);
+    if (!ifs) {
+        return;
+    }
+    std::unordered_map<std::string, int> name2fd;
+    for (auto& entry : fhs_) {
+        name2fd[entry.first] = entry.second->GetFd();
+        name2fd[RmManager::get_fsm_file_name(entry.first)] = entry.second->get_fsm_fd();
+        name2fd[RmManager::get_zone_map_file_name(entry.first)] = entry.second->get_zone_map_fd();
+    }
+    for (auto& entry : ihs_) {
+        name2fd[entry.first] = entry.second->get_fd();
+    }
+    std::vector<PageId> page_ids;
+    std::string name;
+    page_id_t page_no;
+    while (page_ids.size() < buffer_pool_manager_->get_pool_size() && ifs >> name >> page_no) {
+        auto pos = name2fd.find(name);
+        // 跳过已经删除的文件和超出文件末尾的页面
+        if (pos == name2fd.end() || page_no < 0 || page_no >= disk_manager_->get_fd2pageno(pos->second)) {
+            continue;
+        }
+        page_ids.push_back(PageId{pos->second, page_no});
+    }
+    std::sort(page_ids.begin(), page_ids.end(), [](const PageId& a, const PageId& b) {
+        return a.fd != b.fd ? a.fd < b.fd : a.page_no < b.page_no;
+    });
+    page_ids.erase(std::unique(page_ids.begin(), page_ids.end()), page_ids.end());
+    size_t i = 0;
+    while (i < page_ids.size()) {
+        size_t j = i + 1;
+        while (j < page_ids.size() && page_ids[j].fd == page_ids[i].fd &&
+               page_ids[j].page_no == page_ids[j - 1].page_no + 1) {
+            j++;
+        }
+        buffer_pool_manager_->prefetch_pages(page_ids[i].fd, page_ids[i].page_no, static_cast<int>(j - i));
+        i = j;
+    }
+}
+
+/**
+ * @description: 把I/O统计追加到METRICS_FILE_NAME文件中。每次输出一组以"# 时间戳"开头的行，
+ *              每行为"类别 名称=取值 ..."，依次为全局统计、每个打开文件的统计和延迟分布，计数器为数据库启动以来的累计值
+ */
+void SmManager::dump_metrics() {
+    std::ofstream ofs(METRICS_FILE_NAME, std::ios::app);
+    ofs << "# " << std::time(nullptr) << "\n";
+    ofs << "total pool_size=" << buffer_pool_manager_->get_pool_size()
+        << " bg_flushed_pages=" << buffer_pool_manager_->get_bg_flushed_pages();
+    for (auto& [name, value] : io_stats_fields(disk_manager_->get_total_io_stats())) {
+        ofs << " " << name << "=" << value;
+    }
+    ofs << "\n";
+    for (auto& [fd, path] : disk_manager_->list_open_files()) {
+        ofs << "file name=" << path;
+        for (auto& [name, value] : io_stats_fields(disk_manager_->get_file_io_stats(fd))) {
+            ofs << " " << name << "=" << value;
+        }
+        ofs << "\n";
+    }
+    const IoStats& io_stats = disk_manager_->get_io_stats();
+    std::vector<std::pair<std::string, const LatencyHistogram*>> histograms = {
+        {"disk_read", &io_stats.read_latency}, {"disk_write", &io_stats.write_latency},
+        {"fetch_miss", &io_stats.miss_latency}};
+    for (auto& [metric, histogram] : histograms) {
+        ofs << "latency name=" << metric;
+        for (auto& [name, value] : latency_fields(*histogram)) {
+            ofs << " " << name << "=" << value;
+        }
+        ofs << "\n";
+    }
+}
+
+/**
+ * @description: 启动后台线程：每隔BUFFER_POOL_DUMP_INTERVAL_SEC秒保存一次缓冲池页面列表，使崩溃后也能预热；
+ *              每隔METRICS_DUMP_INTERVAL_SEC秒把I/O统计追加到metrics文件。间隔为0的任务不执行
+ */
+void SmManager::start_dump_thread() {
+    if ((BUFFER_POOL_DUMP_INTERVAL_SEC <= 0 && METRICS_DUMP_INTERVAL_SEC <= 0) || dump_thread_.joinable()) {
+        return;
+    }
+    dump_stop_ = false;
+    dump_thread_ = std::thread([this]() {
+        std::unique_lock lock{dump_latch_};
+        for (int seconds = 1; !dump_cv_.wait_for(lock, std::chrono::seconds(1), [this] { return dump_stop_; });
+             seconds++) {
+            try {
+                if (BUFFER_POOL_DUMP_INTERVAL_SEC > 0 && seconds % BUFFER_POOL_DUMP_INTERVAL_SEC == 0) {
+                    dump_buffer_pool();
+                }
+                if (METRICS_DUMP_INTERVAL_SEC > 0 && seconds % METRICS_DUMP_INTERVAL_SEC == 0) {
+                    dump_metrics();
+                }
+            } catch (RMDBError& e) {
+                std::cerr << e.what() << std::endl;
+            }
+        }
+    });
+}
+
+void SmManager::stop_dump_thread() {
+    if (!dump_thread_.joinable()) {
+        return;
+    }
+    {
+        std::scoped_lock lock{dump_latch_};
+        dump_stop_ = true;
+    }
+    dump_cv_.notify_all();
+    dump_thread_.join();
+}
@@ -10,10 +10,15 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "index/ix.h"
 #include "record/rm_file_handle.h"
 #include "sm_defs.h"
 #include "sm_meta.h"
+#include "common/common.h"
 #include "common/context.h"
 
 class Context;
@@ -36,6 +41,11 @@ class SmManager {
     RmManager* rm_manager_;
     IxManager* ix_manager_;
 
+    std::thread dump_thread_;           // 数据库打开期间定期保存缓冲池页面列表和I/O统计的线程
+    std::mutex dump_latch_;             // 保护dump_stop_
+    std::condition_variable dump_cv_;
+    bool dump_stop_ = false;
+
    public:
     SmManager(DiskManager* disk_manager, BufferPoolManager* buffer_pool_manager, RmManager* rm_manager,
               IxManager* ix_manager)
@@ -44,7 +54,7 @@ class SmManager {
           rm_manager_(rm_manager),
           ix_manager_(ix_manager) {}
 
-    ~SmManager() {}
+    ~SmManager() { stop_dump_thread(); }
 
     BufferPoolManager* get_bpm() { return buffer_pool_manager_; }
 
@@ -64,12 +74,21 @@ class SmManager {
 
     void flush_meta();
 
+    FlushStats flush_all_files();
+
+    void checkpoint(Context* context);
+
     void show_tables(Context* context);
 
+    void show_buffer_status(Context* context);
+
     void desc_table(const std::string& tab_name, Context* context);
 
     void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context);
 
+    void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, const std::string& storage,
+                      Context* context);
+
     void drop_table(const std::string& tab_name, Context* context);
 
     void create_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context);
@@ -77,4 +96,21 @@ class SmManager {
     void drop_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context);
     
     void drop_index(const std::string& tab_name, const std::vector<ColMeta>& col_names, Context* context);
+
+    void set_knob(const std::string& knob_name, const Value& value, Context* context);
+
+    size_t load_data(const std::string& file_name, const std::string& tab_name, Context* context);
+
+    int vacuum_table(const std::string& tab_name, Context* context);
+
+    void dump_buffer_pool();
+
+    void load_buffer_pool();
+
+    void dump_metrics();
+
+   private:
+    void start_dump_thread();
+
+    void stop_dump_thread();
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+// Bitmap基准：比较逐位扫描与按字扫描(以及AVX2跳块)的next_bit，
+// 场景为顺序扫描一个页面中的所有记录(RmScan::next)和在几乎写满的页面中找空闲slot(insert_record)
+// 用法: bitmap_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "record/bitmap.h"
+#include "record/rm_defs.h"
+
+namespace {
+
+// 优化之前的实现：逐位调用is_set
+int legacy_next_bit(bool bit, const char *bm, int max_n, int curr) {
+    for (int i = curr + 1; i < max_n; i++) {
+        if (Bitmap::is_set(bm, i) == bit) {
+            return i;
+        }
+    }
+    return max_n;
+}
+
+using NextBit = int (*)(bool, const char *, int, int);
+
+constexpr int BENCH_PAGES = 1024;  // 轮流访问的页面个数
+
+// 与RmManager::create_file相同的每页记录数
+int records_per_page(int record_size) {
+    return (BITMAP_WIDTH * (PAGE_SIZE - 1 - (int)sizeof(RmFileHdr)) + 1) / (1 + record_size * BITMAP_WIDTH);
+}
+
+// 遍历所有为1的位，返回每个页面的耗时(ns)。轮流扫描不同的页面，避免分支预测器记住单个页面的位模式
+double bench_scan(NextBit next_bit, const std::vector<std::vector<char>> &pages, int max_n, int iterations) {
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; it++) {
+        const char *bm = pages[it % pages.size()].data();
+        for (int i = next_bit(true, bm, max_n, -1); i < max_n; i = next_bit(true, bm, max_n, i)) {
+            sink = sink + i;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// 找第一个为0的位，返回每次查找的耗时(ns)
+double bench_first_free(NextBit next_bit, const std::vector<std::vector<char>> &pages, int max_n, int iterations) {
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; it++) {
+        sink = sink + next_bit(false, pages[it % pages.size()].data(), max_n, -1);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    std::mt19937 rng(0);
+
+    printf("%12s %8s %-22s %14s %14s %8s\n", "record_size", "slots", "workload", "legacy ns/op", "word ns/op",
+           "speedup");
+    for (int record_size : {4, 16, 64, 256}) {
+        int max_n = records_per_page(record_size);
+        int size = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        std::vector<std::vector<char>> pages(BENCH_PAGES, std::vector<char>(size));
+        auto report = [&](const char *workload, double legacy, double word) {
+            printf("%12d %8d %-22s %14.1f %14.1f %7.1fx\n", record_size, max_n, workload, legacy, word, legacy / word);
+        };
+
+        // 顺序扫描：每个页面中随机一半的slot有记录
+        for (auto &bm : pages) {
+            Bitmap::init(bm.data(), size);
+            for (int i = 0; i < max_n; i++) {
+                if (rng() % 2) Bitmap::set(bm.data(), i);
+            }
+        }
+        report("scan 50% full", bench_scan(legacy_next_bit, pages, max_n, iterations),
+               bench_scan(Bitmap::next_bit, pages, max_n, iterations));
+
+        // 顺序扫描：稀疏页面，每个页面只有一个随机的slot有记录
+        for (auto &bm : pages) {
+            Bitmap::init(bm.data(), size);
+            Bitmap::set(bm.data(), rng() % max_n);
+        }
+        report("scan 1 record", bench_scan(legacy_next_bit, pages, max_n, iterations),
+               bench_scan(Bitmap::next_bit, pages, max_n, iterations));
+
+        // 插入：页面中只有一个随机的slot空闲
+        for (auto &bm : pages) {
+            memset(bm.data(), 0xff, size);
+            Bitmap::reset(bm.data(), rng() % max_n);
+        }
+        report("first free slot", bench_first_free(legacy_next_bit, pages, max_n, iterations),
+               bench_first_free(Bitmap::next_bit, pages, max_n, iterations));
+    }
+    return 0;
+}
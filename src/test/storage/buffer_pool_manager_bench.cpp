@@ -0,0 +1,87 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+// 缓冲池吞吐量基准：多个线程对常驻页面反复执行fetch_page/unpin_page，
+// 比较单一缓冲池与分区缓冲池在不同线程数下的吞吐量
+// 用法: buffer_pool_manager_bench [num_instances] [ops_per_thread]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/buffer_pool_manager.h"
+
+const std::string BENCH_DB_NAME = "BufferPoolManagerBench_db";
+constexpr size_t BENCH_POOL_SIZE = 4096;
+constexpr int BENCH_PAGES = 2048;  // 所有页面都常驻缓冲池，基准只衡量页表和锁的开销
+
+static double run(DiskManager *disk_manager, int fd, size_t num_instances, int num_threads, int ops_per_thread) {
+    BufferPoolManager bpm(BENCH_POOL_SIZE, disk_manager, num_instances);
+    for (int i = 0; i < BENCH_PAGES; i++) {
+        Page *page = bpm.fetch_page(PageId{fd, i});
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&bpm, fd, tid, ops_per_thread]() {
+            std::mt19937 rng(tid);
+            for (int i = 0; i < ops_per_thread; i++) {
+                PageId page_id{fd, static_cast<page_id_t>(rng() % BENCH_PAGES)};
+                Page *page = bpm.fetch_page(page_id);
+                if (page != nullptr) {
+                    bpm.unpin_page(page_id, false);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(num_threads) * ops_per_thread / secs;
+}
+
+int main(int argc, char **argv) {
+    size_t num_instances = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : BUFFER_POOL_INSTANCES;
+    int ops_per_thread = argc > 2 ? std::atoi(argv[2]) : 200000;
+
+    DiskManager disk_manager;
+    if (disk_manager.is_dir(BENCH_DB_NAME)) {
+        disk_manager.destroy_dir(BENCH_DB_NAME);
+    }
+    disk_manager.create_dir(BENCH_DB_NAME);
+    std::string filename = BENCH_DB_NAME + "/bench";
+    disk_manager.create_file(filename);
+    int fd = disk_manager.open_file(filename);
+    // 预先在磁盘上写出所有页面
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < BENCH_PAGES; i++) {
+        disk_manager.write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager.set_fd2pageno(fd, BENCH_PAGES);
+
+    printf("%8s %16s %16s\n", "threads", "1 instance", (std::to_string(num_instances) + " instances").c_str());
+    for (int num_threads = 1; num_threads <= 16; num_threads *= 2) {
+        double single = run(&disk_manager, fd, 1, num_threads, ops_per_thread);
+        double partitioned = run(&disk_manager, fd, num_instances, num_threads, ops_per_thread);
+        printf("%8d %12.0f op/s %12.0f op/s\n", num_threads, single, partitioned);
+    }
+
+    disk_manager.close_file(fd);
+    disk_manager.destroy_dir(BENCH_DB_NAME);
+    return 0;
+}
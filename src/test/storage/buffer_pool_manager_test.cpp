@@ -1,8 +1,13 @@
 #include "storage/buffer_pool_manager.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include <ctime>
+#include <map>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -427,3 +432,776 @@ TEST_F(BufferPoolManagerTest, ConcurrencyTest) {
 
     disk_manager_->close_file(fd);
 }
+
+/**
+ * @brief 分区缓冲池测试（单文件），多个线程并发读写不同的页面
+ * @note 生成测试文件partitioned_test
+ */
+TEST_F(BufferPoolManagerTest, PartitionedTest) {
+    const int num_threads = 8;
+    const int pages_per_thread = 64;
+    const size_t buffer_pool_size = 100;
+    const size_t num_instances = 4;
+
+    const std::string filename = "partitioned_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, num_instances);
+    EXPECT_EQ(num_instances, bpm->get_num_instances());
+    EXPECT_EQ(buffer_pool_size, bpm->get_pool_size());
+
+    // 每个线程创建自己的页面，页面总数超过缓冲池大小，迫使各分区进行页面替换
+    std::vector<std::vector<PageId>> page_ids(num_threads);
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&bpm, &page_ids, tid, fd]() {
+            for (int i = 0; i < pages_per_thread; i++) {
+                PageId page_id = {.fd = fd, .page_no = INVALID_PAGE_ID};
+                Page *page = bpm->new_page(&page_id);
+                while (page == nullptr) {
+                    page = bpm->new_page(&page_id);
+                }
+                EXPECT_EQ(page_id, page->get_page_id());
+                snprintf(page->get_data(), PAGE_SIZE, "%d", page_id.page_no);
+                page_ids[tid].push_back(page_id);
+                EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+            }
+            for (int r = 0; r < 4; r++) {
+                for (auto &page_id : page_ids[tid]) {
+                    Page *page = bpm->fetch_page(page_id);
+                    while (page == nullptr) {
+                        page = bpm->fetch_page(page_id);
+                    }
+                    EXPECT_EQ(0, strcmp(std::to_string(page_id.page_no).c_str(), page->get_data()));
+                    EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // 刷盘之后磁盘上的内容应与写入的一致
+    bpm->flush_all_pages(fd);
+    char buf[PAGE_SIZE];
+    for (auto &ids : page_ids) {
+        for (auto &page_id : ids) {
+            disk_manager_->read_page(fd, page_id.page_no, buf, PAGE_SIZE);
+            EXPECT_EQ(0, strcmp(std::to_string(page_id.page_no).c_str(), buf));
+            EXPECT_EQ(true, bpm->delete_page(page_id));
+        }
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 使用BufferAccessStrategy的顺序扫描只占用私有的帧环，不会淘汰缓冲池中的热点页面
+ * @note 生成测试文件ring_test
+ */
+TEST_F(BufferPoolManagerTest, AccessStrategyTest) {
+    const int num_hot = 8;
+    const int num_scan = 200;
+    const size_t buffer_pool_size = 16;
+    const size_t ring_size = 4;
+
+    const std::string filename = "ring_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_hot + num_scan; i++) {
+        snprintf(buf, PAGE_SIZE, "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+
+    for (size_t num_instances : {1, 2}) {
+        auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, num_instances);
+        // 读入热点页面
+        for (int i = 0; i < num_hot; i++) {
+            Page *page = bpm->fetch_page(PageId{fd, i});
+            ASSERT_NE(nullptr, page);
+            EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+        }
+        // 修改磁盘上热点页面的内容，之后若从磁盘重新读入则会读到新内容
+        for (int i = 0; i < num_hot; i++) {
+            snprintf(buf, PAGE_SIZE, "disk%d", i);
+            disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+        }
+        // 使用帧环扫描远多于缓冲池大小的页面
+        {
+            BufferAccessStrategy strategy(bpm.get(), ring_size);
+            for (int i = num_hot; i < num_hot + num_scan; i++) {
+                Page *page = bpm->fetch_page(PageId{fd, i}, &strategy);
+                ASSERT_NE(nullptr, page);
+                EXPECT_EQ(0, strcmp(std::to_string(i).c_str(), page->get_data()));
+                EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+            }
+        }
+        // 热点页面仍然在缓冲池中
+        for (int i = 0; i < num_hot; i++) {
+            Page *page = bpm->fetch_page(PageId{fd, i});
+            ASSERT_NE(nullptr, page);
+            EXPECT_EQ(0, strcmp(std::to_string(i).c_str(), page->get_data()));
+            EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+        }
+        // 帧环归还之后，缓冲池中所有的帧都可以被使用
+        std::vector<PageId> page_ids;
+        for (size_t i = 0; i < buffer_pool_size; i++) {
+            PageId page_id{fd, static_cast<page_id_t>(num_hot + i)};
+            Page *page = bpm->fetch_page(page_id);
+            if (page != nullptr) {
+                page_ids.push_back(page_id);
+            }
+        }
+        EXPECT_GE(page_ids.size(), buffer_pool_size / 2);
+        for (auto &page_id : page_ids) {
+            EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+        }
+        // 恢复磁盘上热点页面的内容
+        for (int i = 0; i < num_hot; i++) {
+            snprintf(buf, PAGE_SIZE, "%d", i);
+            disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+        }
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 预读测试：prefetch_pages预读连续页面，prefetch_chain沿着页面中记录的下一个页面号预读
+ * @note 生成测试文件prefetch_test
+ */
+TEST_F(BufferPoolManagerTest, PrefetchTest) {
+    const int num_pages = 32;
+    const size_t buffer_pool_size = 64;
+
+    const std::string filename = "prefetch_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    // 每个页面的开头记录链上的下一个页面号：奇数页面组成一条 1 -> 3 -> 5 -> ... 的链
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        memset(buf, 0, PAGE_SIZE);
+        *reinterpret_cast<page_id_t *>(buf) = (i % 2 == 1 && i + 2 < num_pages) ? i + 2 : INVALID_PAGE_ID;
+        snprintf(buf + sizeof(page_id_t), PAGE_SIZE - sizeof(page_id_t), "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 4);
+    // 预读前一半的页面，以及奇数页面组成的链
+    bpm->prefetch_pages(fd, 0, num_pages / 2);
+    bpm->prefetch_chain(fd, 1, num_pages, [](Page *page) { return *reinterpret_cast<page_id_t *>(page->get_data()); });
+    bpm->wait_prefetch();
+
+    // 覆盖磁盘上的内容，已经预读的页面仍然是旧内容，没有预读的页面读到新内容
+    for (int i = 0; i < num_pages; i++) {
+        memset(buf, 0, PAGE_SIZE);
+        snprintf(buf + sizeof(page_id_t), PAGE_SIZE - sizeof(page_id_t), "new%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    for (int i = 0; i < num_pages; i++) {
+        Page *page = bpm->fetch_page(PageId{fd, i});
+        ASSERT_NE(nullptr, page);
+        bool prefetched = i < num_pages / 2 || i % 2 == 1;
+        std::string expected = (prefetched ? "" : "new") + std::to_string(i);
+        EXPECT_EQ(expected, std::string(page->get_data() + sizeof(page_id_t)));
+        EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+    }
+
+    // 预读超出文件末尾的页面会被忽略
+    bpm->prefetch_pages(fd, num_pages, 4);
+    bpm->wait_prefetch();
+    EXPECT_EQ(true, bpm->delete_page(PageId{fd, num_pages}));
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 后台刷脏线程提前写回replacer尾部的脏页，页面LSN大于已持久化日志号的脏页不写回
+ */
+TEST_F(BufferPoolManagerTest, BackgroundFlusherTest) {
+    const int num_pages = 20;
+    const size_t buffer_pool_size = 20;
+
+    const std::string filename = "bg_flush_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager);
+    // 页面按创建顺序进入replacer，最先创建的页面最先被淘汰
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id);
+        ASSERT_NE(nullptr, page);
+        ASSERT_EQ(i, page_id.page_no);
+        snprintf(page->get_data() + Page::OFFSET_PAGE_HDR, PAGE_SIZE - Page::OFFSET_PAGE_HDR, "page%d", i);
+        page->set_page_lsn(i == 2 ? 100 : 0);
+        EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+    }
+
+    // 淘汰端的5个帧应当保持干净，其中页面2的日志还没有持久化
+    std::atomic<lsn_t> persisted_lsn{50};
+    bpm->set_bg_clean_ratio(0.25);
+    bpm->start_background_flusher([&persisted_lsn]() { return persisted_lsn.load(); });
+    for (int i = 0; i < 200 && bpm->get_bg_flushed_pages() < 4; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    bpm->stop_background_flusher();
+    EXPECT_EQ(4, bpm->get_bg_flushed_pages());
+
+    char buf[PAGE_SIZE];
+    for (int i : {0, 1, 3, 4}) {
+        disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+        EXPECT_EQ("page" + std::to_string(i), std::string(buf + Page::OFFSET_PAGE_HDR));
+    }
+
+    // 日志持久化之后页面2也可以写回
+    persisted_lsn = 100;
+    EXPECT_EQ(1, bpm->bg_flush_round());
+    disk_manager_->read_page(fd, 2, buf, PAGE_SIZE);
+    EXPECT_EQ("page2", std::string(buf + Page::OFFSET_PAGE_HDR));
+
+    // 刷脏速率为0时暂停后台刷脏
+    bpm->set_bg_clean_ratio(1.0);
+    bpm->set_bg_flush_rate(0);
+    EXPECT_EQ(0, bpm->bg_flush_round());
+    bpm->set_bg_flush_rate(BG_FLUSH_RATE);
+    EXPECT_EQ(num_pages - 5, bpm->bg_flush_round());
+    for (int i = 0; i < num_pages; i++) {
+        Page *page = bpm->fetch_page(PageId{fd, i});
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(false, page->is_dirty());
+        EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 后台刷脏与修改页面的线程并发，写回的页面映像总是某次完整修改之后的内容
+ * @note 生成测试文件bg_flush_latch_test
+ */
+TEST_F(BufferPoolManagerTest, BackgroundFlusherLatchTest) {
+    const int num_pages = 4;
+    const int num_writers = 4;
+    const int ops_per_writer = 2000;
+
+    const std::string filename = "bg_flush_latch_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    auto bpm = std::make_unique<BufferPoolManager>(16, disk_manager, 1);
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        ASSERT_NE(nullptr, bpm->new_page(&page_id));
+        EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+    }
+    bpm->set_bg_clean_ratio(1.0);
+    // 每轮刷脏之后检查磁盘上的页面映像，写回只发生在刷脏线程中，读盘时不会与写盘并发
+    std::atomic<bool> stop{false};
+    int torn = 0;
+    std::thread flusher([&]() {
+        char buf[PAGE_SIZE];
+        while (!stop) {
+            bpm->bg_flush_round();
+            for (int i = 0; i < num_pages; i++) {
+                disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+                torn += std::count(buf, buf + PAGE_SIZE, buf[0]) != PAGE_SIZE;
+            }
+        }
+    });
+    // 每次修改把整个页面填成同一个字节，LSN字段也随之改变，刷脏时不检查WAL
+    std::vector<std::thread> writers;
+    for (int t = 0; t < num_writers; t++) {
+        writers.emplace_back([&, t]() {
+            for (int i = 0; i < ops_per_writer; i++) {
+                WritePageGuard guard = bpm->fetch_page_write(PageId{fd, (t + i) % num_pages});
+                ASSERT_EQ(true, guard.is_valid());
+                // 分两次填写，中间让出CPU，不持有读锁的写回很容易得到只修改了一半的页面
+                char c = static_cast<char>('a' + (t * ops_per_writer + i) % 26);
+                memset(guard.get_data_mut(), c, PAGE_SIZE / 2);
+                std::this_thread::yield();
+                memset(guard.get_data_mut() + PAGE_SIZE / 2, c, PAGE_SIZE / 2);
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    stop = true;
+    flusher.join();
+    EXPECT_GT(bpm->get_bg_flushed_pages(), 0);
+    EXPECT_EQ(0, torn);
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief flush_all_pages在页面的读锁下复制页面再写回，与持有写锁修改页面的线程并发时不会写出修改了一半的页面
+ */
+TEST_F(BufferPoolManagerTest, FlushAllPagesLatchTest) {
+    const int num_pages = 4;
+    const int num_writers = 4;
+    const int ops_per_writer = 2000;
+
+    const std::string filename = "flush_all_latch_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    auto bpm = std::make_unique<BufferPoolManager>(16, disk_manager, 1);
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        ASSERT_NE(nullptr, bpm->new_page(&page_id));
+        EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+    }
+    // 每次写回之后检查磁盘上的页面映像，写回只发生在检查点线程中，读盘时不会与写盘并发
+    std::atomic<bool> stop{false};
+    int torn = 0;
+    size_t flushed = 0;
+    std::thread checkpointer([&]() {
+        char buf[PAGE_SIZE];
+        while (!stop) {
+            flushed += bpm->flush_all_pages(fd).num_pages;
+            for (int i = 0; i < num_pages; i++) {
+                disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+                torn += std::count(buf, buf + PAGE_SIZE, buf[0]) != PAGE_SIZE;
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (int t = 0; t < num_writers; t++) {
+        writers.emplace_back([&, t]() {
+            for (int i = 0; i < ops_per_writer; i++) {
+                WritePageGuard guard = bpm->fetch_page_write(PageId{fd, (t + i) % num_pages});
+                ASSERT_EQ(true, guard.is_valid());
+                char c = static_cast<char>('a' + (t * ops_per_writer + i) % 26);
+                memset(guard.get_data_mut(), c, PAGE_SIZE / 2);
+                std::this_thread::yield();
+                memset(guard.get_data_mut() + PAGE_SIZE / 2, c, PAGE_SIZE / 2);
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    stop = true;
+    checkpointer.join();
+    EXPECT_GT(flushed, 0);
+    EXPECT_EQ(0, torn);
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 帧描述符紧凑排列，页面数据按PAGE_SIZE对齐；请求大页失败时数据区退化为普通页
+ */
+TEST_F(BufferPoolManagerTest, FrameLayoutTest) {
+    static_assert(sizeof(Page) == PAGE_DESC_ALIGN, "frame descriptor should fit in half a cache line");
+
+    for (bool use_huge_pages : {false, true}) {
+        const size_t num_pages = 1024;
+        PageArena arena(num_pages, use_huge_pages);
+        for (size_t i = 0; i < num_pages; i++) {
+            char *data = arena.get_page(i);
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(data) % PAGE_SIZE);
+            EXPECT_EQ(0, data[0]);
+            EXPECT_EQ(0, data[PAGE_SIZE - 1]);
+            data[0] = data[PAGE_SIZE - 1] = 1;
+        }
+    }
+
+    const std::string filename = "frame_layout_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const size_t buffer_pool_size = 16;
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 2);
+    std::vector<PageId> page_ids;
+    for (size_t i = 0; i < buffer_pool_size; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id);
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(page->get_data()) % PAGE_SIZE);
+        page_ids.push_back(page_id);
+    }
+    for (auto &page_id : page_ids) {
+        EXPECT_EQ(true, bpm->unpin_page(page_id, false));
+    }
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 页表的插入、查找和删除与std::map的结果一致，页面号超过65535时不同页面的映射互不覆盖
+ */
+TEST_F(BufferPoolManagerTest, PageTableTest) {
+    const size_t max_entries = 1000;
+    PageTable page_table(max_entries);
+    EXPECT_LE(2 * max_entries, page_table.capacity());
+
+    // 旧的哈希(fd << 16) | page_no下这两个页面会冲突
+    frame_id_t frame_id;
+    page_table.insert(PageId{1, 0}, 1);
+    page_table.insert(PageId{0, 65536}, 2);
+    EXPECT_TRUE(page_table.find(PageId{1, 0}, &frame_id));
+    EXPECT_EQ(1, frame_id);
+    EXPECT_TRUE(page_table.find(PageId{0, 65536}, &frame_id));
+    EXPECT_EQ(2, frame_id);
+    EXPECT_TRUE(page_table.erase(PageId{1, 0}));
+    EXPECT_TRUE(page_table.erase(PageId{0, 65536}));
+    EXPECT_FALSE(page_table.erase(PageId{0, 65536}));
+
+    std::map<PageId, frame_id_t> mock;
+    std::mt19937 rng(0);
+    for (int i = 0; i < 200000; i++) {
+        PageId page_id{static_cast<int>(rng() % 4), static_cast<page_id_t>(rng() % 3000) * 65536};
+        auto it = mock.find(page_id);
+        if (it != mock.end()) {
+            ASSERT_TRUE(page_table.find(page_id, &frame_id));
+            ASSERT_EQ(it->second, frame_id);
+            ASSERT_TRUE(page_table.erase(page_id));
+            mock.erase(it);
+        } else if (mock.size() < max_entries) {
+            ASSERT_FALSE(page_table.find(page_id, &frame_id));
+            frame_id_t new_frame_id = static_cast<frame_id_t>(rng() % max_entries);
+            page_table.insert(page_id, new_frame_id);
+            mock[page_id] = new_frame_id;
+        }
+    }
+    EXPECT_EQ(mock.size(), page_table.size());
+    for (auto &[page_id, expected] : mock) {
+        ASSERT_TRUE(page_table.find(page_id, &frame_id));
+        EXPECT_EQ(expected, frame_id);
+    }
+
+    // 扩容之后原有的映射仍然可以找到
+    page_table.reserve(4 * max_entries);
+    EXPECT_LE(8 * max_entries, page_table.capacity());
+    EXPECT_EQ(mock.size(), page_table.size());
+    for (auto &[page_id, expected] : mock) {
+        ASSERT_TRUE(page_table.find(page_id, &frame_id));
+        EXPECT_EQ(expected, frame_id);
+    }
+}
+
+/**
+ * @brief 多个线程在很小的缓冲池上反复访问页面，命中走无锁路径，同时不断有页面被淘汰，
+ *        每次得到的页面内容都应与页面号一致
+ * @note 生成测试文件lock_free_hit_test
+ */
+TEST_F(BufferPoolManagerTest, LockFreeHitTest) {
+    const int num_threads = 8;
+    const int num_pages = 64;
+    const int ops_per_thread = 20000;
+    const size_t buffer_pool_size = 16;
+
+    const std::string filename = "lock_free_hit_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        snprintf(buf, PAGE_SIZE, "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 1);
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&bpm, fd, tid]() {
+            std::mt19937 rng(tid);
+            for (int i = 0; i < ops_per_thread; i++) {
+                // 一半的访问集中在4个热点页面上，保证既有命中也有淘汰
+                page_id_t page_no = (rng() & 1) ? static_cast<page_id_t>(rng() % 4)
+                                                : static_cast<page_id_t>(rng() % num_pages);
+                PageId page_id{fd, page_no};
+                Page *page = bpm->fetch_page(page_id);
+                if (page == nullptr) {
+                    continue;
+                }
+                ASSERT_EQ(page_id, page->get_page_id());
+                ASSERT_EQ(0, strcmp(std::to_string(page_no).c_str(), page->get_data()));
+                ASSERT_EQ(true, bpm->unpin_page(page_id, false));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // 所有页面都已经unpin，缓冲池中的每个页面都可以被删除
+    for (int i = 0; i < num_pages; i++) {
+        EXPECT_EQ(true, bpm->delete_page(PageId{fd, i}));
+    }
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 无锁路径的命中不获取replacer的互斥锁，但访问次数在unpin时交给replacer：
+ *        被命中过的页面在LRU-K中有两次访问，一次顺序扫描不会把它淘汰
+ * @note 生成测试文件hit_history_test
+ */
+TEST_F(BufferPoolManagerTest, HitHistoryTest) {
+    if (REPLACER_TYPE != "LRU-K") {
+        GTEST_SKIP() << "scan resistance is specific to LRU-K";
+    }
+    const int num_pages = 64;
+    const size_t buffer_pool_size = 8;
+
+    const std::string filename = "hit_history_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        snprintf(buf, PAGE_SIZE, "%d", i);
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager, 1);
+    PageId hot{fd, 0};
+    for (int i = 0; i < 2; i++) {
+        ASSERT_NE(nullptr, bpm->fetch_page(hot));
+        ASSERT_EQ(true, bpm->unpin_page(hot, false));
+    }
+    for (int i = 1; i < num_pages; i++) {
+        ASSERT_NE(nullptr, bpm->fetch_page(PageId{fd, i}));
+        ASSERT_EQ(true, bpm->unpin_page(PageId{fd, i}, false));
+    }
+    // 磁盘上的内容被改写，页面仍在缓冲池中时读到的是旧内容
+    snprintf(buf, PAGE_SIZE, "changed");
+    disk_manager_->write_page(fd, 0, buf, PAGE_SIZE);
+    Page *page = bpm->fetch_page(hot);
+    ASSERT_NE(nullptr, page);
+    EXPECT_STREQ("0", page->get_data());
+    bpm->unpin_page(hot, false);
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 页面守卫析构时自动释放页面锁并unpin；同一页面的多个读守卫可以同时存在，写守卫与读守卫互斥
+ * @note 生成测试文件page_guard_test
+ */
+TEST_F(BufferPoolManagerTest, PageGuardTest) {
+    const std::string filename = "page_guard_test";
+    auto disk_manager = BufferPoolManagerTest::disk_manager_.get();
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    auto bpm = std::make_unique<BufferPoolManager>(4, disk_manager, 1);
+
+    PageId page_id{fd, INVALID_PAGE_ID};
+    ASSERT_NE(nullptr, bpm->new_page(&page_id));
+    EXPECT_EQ(true, bpm->unpin_page(page_id, true));
+
+    {
+        WritePageGuard guard = bpm->fetch_page_write(page_id);
+        ASSERT_TRUE(guard.is_valid());
+        snprintf(guard.get_data_mut(), PAGE_SIZE, "hello");
+        // 被固定的页面不能删除
+        EXPECT_EQ(false, bpm->delete_page(page_id));
+        // 移动之后只有新对象持有页面
+        WritePageGuard moved = std::move(guard);
+        EXPECT_FALSE(guard.is_valid());
+        EXPECT_EQ(page_id, moved.get_page_id());
+    }
+    // 写守卫已经unpin并把页面标记为脏页
+    bpm->flush_all_pages(fd);
+    char buf[PAGE_SIZE];
+    disk_manager_->read_page(fd, page_id.page_no, buf, PAGE_SIZE);
+    EXPECT_STREQ("hello", buf);
+
+    {
+        ReadPageGuard guard1 = bpm->fetch_page_read(page_id);
+        ReadPageGuard guard2 = bpm->fetch_page_read(page_id);
+        EXPECT_STREQ("hello", guard1.get_data());
+        EXPECT_STREQ("hello", guard2.get_data());
+
+        // 持有读锁期间写者被阻塞，两个读守卫都释放之后才能获取写锁
+        std::atomic<bool> written{false};
+        std::thread writer([&]() {
+            WritePageGuard guard = bpm->fetch_page_write(page_id);
+            snprintf(guard.get_data_mut(), PAGE_SIZE, "world");
+            written = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(written);
+        guard1.drop();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(written);
+        guard2.drop();
+        writer.join();
+        EXPECT_TRUE(written);
+    }
+    EXPECT_STREQ("world", bpm->fetch_page_read(page_id).get_data());
+    EXPECT_EQ(true, bpm->delete_page(page_id));
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief flush_all_pages按页号排序，把相邻的脏页合并为一个写请求；写回期间被固定的页面仍然可以正常访问
+ */
+TEST_F(BufferPoolManagerTest, SortedFlushTest) {
+    const std::string filename = "SortedFlushTest_db";
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    auto bpm = std::make_unique<BufferPoolManager>(256, disk_manager_.get(), 4);
+
+    const int num_pages = 100;
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id);
+        ASSERT_NE(nullptr, page);
+        ASSERT_EQ(i, page_id.page_no);
+        snprintf(page->get_data(), PAGE_SIZE, "page %d", i);
+        bpm->unpin_page(page_id, true);
+    }
+    // 页面分散在各个分区中，合并之后是一个连续区间，按FLUSH_MAX_RUN_PAGES切分
+    FlushStats stats = bpm->flush_all_pages(fd);
+    EXPECT_EQ(num_pages, stats.num_pages);
+    EXPECT_EQ(num_pages * PAGE_SIZE, stats.num_bytes);
+    EXPECT_EQ((num_pages + FLUSH_MAX_RUN_PAGES - 1) / FLUSH_MAX_RUN_PAGES, stats.num_writes);
+    char buf[PAGE_SIZE];
+    for (int i = 0; i < num_pages; i++) {
+        disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+        EXPECT_EQ("page " + std::to_string(i), std::string(buf));
+    }
+    EXPECT_EQ(0, bpm->flush_all_pages(fd).num_pages);
+
+    // 修改三段不相邻的页面，得到三个写请求
+    std::vector<int> dirty = {3, 4, 5, 6, 20, 50, 51};
+    for (int i : dirty) {
+        Page *page = bpm->fetch_page(PageId{fd, i});
+        snprintf(page->get_data(), PAGE_SIZE, "dirty %d", i);
+        bpm->unpin_page(PageId{fd, i}, true);
+    }
+    // 被其他线程固定的页面也会写回，写回之后固定计数不变
+    ASSERT_NE(nullptr, bpm->fetch_page(PageId{fd, 20}));
+    stats = bpm->flush_all_pages(fd);
+    EXPECT_EQ(dirty.size(), stats.num_pages);
+    EXPECT_EQ(3, stats.num_writes);
+    for (int i : dirty) {
+        disk_manager_->read_page(fd, i, buf, PAGE_SIZE);
+        EXPECT_EQ("dirty " + std::to_string(i), std::string(buf));
+    }
+    EXPECT_EQ(true, bpm->unpin_page(PageId{fd, 20}, false));
+    EXPECT_EQ(false, bpm->unpin_page(PageId{fd, 20}, false));
+    EXPECT_EQ(true, bpm->delete_page(PageId{fd, 20}));
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief 在线扩容和缩容：扩容后可以同时容纳更多页面；缩容时写回被回收的chunk中的脏页；chunk中有被固定的页面时不会被回收
+ */
+TEST_F(BufferPoolManagerTest, ResizeTest) {
+    const std::string filename = "ResizeTest_db";
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const size_t chunk_frames = 64;  // 初始大小小于BUFFER_POOL_CHUNK_SIZE，chunk大小等于初始大小
+    auto bpm = std::make_unique<BufferPoolManager>(chunk_frames, disk_manager_.get(), 1);
+
+    // 扩容到4个chunk，所有帧都可以同时被固定
+    EXPECT_EQ(4 * chunk_frames, bpm->resize(4 * chunk_frames));
+    EXPECT_EQ(4 * chunk_frames, bpm->get_pool_size());
+    const int num_pages = 4 * chunk_frames;
+    for (int i = 0; i < num_pages; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm->new_page(&page_id);
+        ASSERT_NE(nullptr, page);
+        snprintf(page->get_data(), PAGE_SIZE, "page %d", i);
+    }
+    PageId page_id{fd, INVALID_PAGE_ID};
+    EXPECT_EQ(nullptr, bpm->new_page(&page_id));
+
+    // 所有帧都被固定，无法缩容
+    EXPECT_EQ(4 * chunk_frames, bpm->resize(chunk_frames));
+    for (int i = 0; i < num_pages; i++) {
+        EXPECT_EQ(true, bpm->unpin_page(PageId{fd, i}, true));
+    }
+
+    // 缩容后被回收的chunk中的脏页已经写回，重新读入的内容不变
+    EXPECT_EQ(chunk_frames, bpm->resize(chunk_frames));
+    EXPECT_EQ(chunk_frames, bpm->get_pool_size());
+    for (int i = 0; i < num_pages; i++) {
+        Page *page = bpm->fetch_page(PageId{fd, i});
+        ASSERT_NE(nullptr, page);
+        EXPECT_EQ("page " + std::to_string(i), std::string(page->get_data()));
+        bpm->unpin_page(PageId{fd, i}, false);
+    }
+    // 只能同时固定chunk_frames个页面
+    for (size_t i = 0; i < chunk_frames; i++) {
+        ASSERT_NE(nullptr, bpm->fetch_page(PageId{fd, static_cast<page_id_t>(i)}));
+    }
+    EXPECT_EQ(nullptr, bpm->fetch_page(PageId{fd, static_cast<page_id_t>(chunk_frames)}));
+
+    // 再次扩容复用被回收的chunk
+    EXPECT_EQ(2 * chunk_frames, bpm->resize(2 * chunk_frames));
+    Page *page = bpm->fetch_page(PageId{fd, static_cast<page_id_t>(chunk_frames)});
+    ASSERT_NE(nullptr, page);
+    EXPECT_EQ("page " + std::to_string(chunk_frames), std::string(page->get_data()));
+    bpm->unpin_page(PageId{fd, static_cast<page_id_t>(chunk_frames)}, false);
+    for (size_t i = 0; i < chunk_frames; i++) {
+        EXPECT_EQ(true, bpm->unpin_page(PageId{fd, static_cast<page_id_t>(i)}, false));
+    }
+
+    disk_manager_->close_file(fd);
+}
+
+/**
+ * @brief fetch_page的命中、缺页、淘汰和写回脏页按文件计入I/O统计
+ */
+TEST_F(BufferPoolManagerTest, IoStatsTest) {
+    const std::string filename = "IoStatsTest_db";
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const size_t pool_size = 4;
+    auto bpm = std::make_unique<BufferPoolManager>(pool_size, disk_manager_.get(), 1);
+
+    // 新建的页面不计入命中和缺页
+    for (size_t i = 0; i < pool_size; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        ASSERT_NE(nullptr, bpm->new_page(&page_id));
+        bpm->unpin_page(page_id, true);
+    }
+    for (size_t i = 0; i < pool_size; i++) {
+        ASSERT_NE(nullptr, bpm->fetch_page(PageId{fd, static_cast<page_id_t>(i)}));
+        bpm->unpin_page(PageId{fd, static_cast<page_id_t>(i)}, false);
+    }
+    FileIoStats stats = disk_manager_->get_file_io_stats(fd);
+    EXPECT_EQ(pool_size, stats.fetch_hits);
+    EXPECT_EQ(0, stats.fetch_misses);
+    EXPECT_EQ(1.0, stats.hit_ratio());
+
+    // 新页面淘汰一个脏页；再读入被淘汰的页面时缺页，又淘汰一个脏页
+    PageId page_id{fd, INVALID_PAGE_ID};
+    ASSERT_NE(nullptr, bpm->new_page(&page_id));
+    bpm->unpin_page(page_id, false);
+    stats = disk_manager_->get_file_io_stats(fd);
+    EXPECT_EQ(1, stats.evictions);
+    EXPECT_EQ(1, stats.dirty_writebacks);
+    for (size_t i = 0; i < pool_size; i++) {
+        ASSERT_NE(nullptr, bpm->fetch_page(PageId{fd, static_cast<page_id_t>(i)}));
+        bpm->unpin_page(PageId{fd, static_cast<page_id_t>(i)}, false);
+    }
+    stats = disk_manager_->get_file_io_stats(fd);
+    EXPECT_LE(1, stats.fetch_misses);
+    EXPECT_EQ(2 * pool_size, stats.fetch_hits + stats.fetch_misses);
+    EXPECT_EQ(stats.fetch_misses, stats.num_reads);
+    EXPECT_EQ(1 + stats.fetch_misses, stats.evictions);
+    EXPECT_EQ(stats.dirty_writebacks, stats.num_writes);
+    EXPECT_LE(stats.fetch_misses, disk_manager_->get_io_stats().miss_latency.count());
+
+    // flush_all_pages写回的页面计入flushed_pages
+    FlushStats flushed = bpm->flush_all_pages(fd);
+    EXPECT_EQ(flushed.num_pages, disk_manager_->get_file_io_stats(fd).flushed_pages);
+
+    disk_manager_->close_file(fd);
+}
@@ -0,0 +1,118 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+// 比较普通模式(经过内核页缓存)与O_DIRECT模式下缓冲池的吞吐量：
+// 文件大小超过缓冲池，多个线程随机fetch_page/unpin_page，其中一部分页面被修改，淘汰时写回磁盘。
+// 普通模式下未命中的页面多半可以从内核页缓存中读到，O_DIRECT模式下每次未命中都访问磁盘，
+// 但不占用额外的页缓存内存，缓冲池可以按照机器的实际内存配置
+// 用法: direct_io_bench [file_pages] [pool_pages] [ops_per_thread] [num_threads]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/buffer_pool_manager.h"
+
+const std::string BENCH_DB_NAME = "DirectIoBench_db";
+
+struct BenchResult {
+    double seq_pages_per_sec;
+    double rand_ops_per_sec;
+};
+
+static BenchResult run(DiskManager *disk_manager, const std::string &filename, bool direct_io, int file_pages,
+                       size_t pool_pages, int ops_per_thread, int num_threads) {
+    int fd = disk_manager->open_file(filename, direct_io);
+    disk_manager->set_fd2pageno(fd, file_pages);
+    BenchResult result{};
+    {
+        BufferPoolManager bpm(pool_pages, disk_manager, BUFFER_POOL_INSTANCES);
+
+        // 顺序扫描整个文件
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < file_pages; i++) {
+            Page *page = bpm.fetch_page(PageId{fd, i});
+            bpm.unpin_page(page->get_page_id(), false);
+        }
+        auto end = std::chrono::steady_clock::now();
+        result.seq_pages_per_sec = file_pages / std::chrono::duration<double>(end - start).count();
+
+        // 随机读写，10%的访问修改页面
+        std::vector<std::thread> threads;
+        start = std::chrono::steady_clock::now();
+        for (int tid = 0; tid < num_threads; tid++) {
+            threads.emplace_back([&bpm, fd, tid, file_pages, ops_per_thread]() {
+                std::mt19937 rng(tid);
+                for (int i = 0; i < ops_per_thread; i++) {
+                    PageId page_id{fd, static_cast<page_id_t>(rng() % file_pages)};
+                    Page *page = bpm.fetch_page(page_id);
+                    if (page == nullptr) {
+                        continue;
+                    }
+                    bool dirty = rng() % 10 == 0;
+                    if (dirty) {
+                        page->get_data()[Page::OFFSET_PAGE_HDR] ^= 1;
+                    }
+                    bpm.unpin_page(page_id, dirty);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        end = std::chrono::steady_clock::now();
+        result.rand_ops_per_sec =
+            static_cast<double>(num_threads) * ops_per_thread / std::chrono::duration<double>(end - start).count();
+        bpm.flush_all_pages(fd);
+    }
+    if (direct_io && !disk_manager->is_direct_io(fd)) {
+        printf("warning: O_DIRECT is not supported by the file system, fell back to buffered I/O\n");
+    }
+    disk_manager->close_file(fd);
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int file_pages = argc > 1 ? std::atoi(argv[1]) : 65536;
+    size_t pool_pages = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 16384;
+    int ops_per_thread = argc > 3 ? std::atoi(argv[3]) : 50000;
+    int num_threads = argc > 4 ? std::atoi(argv[4]) : 4;
+
+    DiskManager disk_manager;
+    if (disk_manager.is_dir(BENCH_DB_NAME)) {
+        disk_manager.destroy_dir(BENCH_DB_NAME);
+    }
+    disk_manager.create_dir(BENCH_DB_NAME);
+    std::string filename = BENCH_DB_NAME + "/bench";
+    disk_manager.create_file(filename);
+    int fd = disk_manager.open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < file_pages; i++) {
+        disk_manager.write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager.close_file(fd);
+
+    printf("file %d pages, buffer pool %zu pages, %d threads x %d ops\n", file_pages, pool_pages, num_threads,
+           ops_per_thread);
+    printf("%10s %18s %18s\n", "mode", "seq scan", "random r/w");
+    for (bool direct_io : {false, true}) {
+        BenchResult result =
+            run(&disk_manager, filename, direct_io, file_pages, pool_pages, ops_per_thread, num_threads);
+        printf("%10s %11.0f page/s %13.0f op/s\n", direct_io ? "O_DIRECT" : "buffered", result.seq_pages_per_sec,
+               result.rand_ops_per_sec);
+    }
+
+    disk_manager.destroy_dir(BENCH_DB_NAME);
+    return 0;
+}
@@ -1,7 +1,10 @@
 #include "storage/disk_manager.h"
+#include "storage/page_arena.h"
 
 #include <cassert>
+#include <atomic>
 #include <cstring>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -147,3 +150,355 @@ TEST_F(DiskManagerTest, PageOperation) {
     disk_manager_->destroy_file(filename);
     EXPECT_EQ(disk_manager_->is_file(filename), false);
 }
+
+/**
+ * @brief 测试批量异步读写，io_uring后端和pread/pwrite线程池后端的结果应一致
+ */
+TEST_F(DiskManagerTest, AsyncIo) {
+    const int num_pages = 300;
+    const std::string filename = "AsyncIoTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    std::vector<std::unique_ptr<AsyncIo>> backends;
+    backends.push_back(AsyncIo::create(64));
+    backends.push_back(AsyncIo::create_thread_pool(4));
+    for (auto &backend : backends) {
+        std::vector<char> write_buf(num_pages * PAGE_SIZE);
+        std::vector<char> read_buf(num_pages * PAGE_SIZE, 0);
+        rand_buf(write_buf.data(), write_buf.size());
+
+        // 一批写请求，请求数超过队列深度
+        std::atomic<int> completed{0};
+        std::vector<AsyncIoRequest> requests;
+        for (int i = 0; i < num_pages; i++) {
+            requests.push_back(AsyncIoRequest{fd, i, write_buf.data() + i * PAGE_SIZE, PAGE_SIZE, true,
+                                              [&completed](ssize_t res) {
+                                                  EXPECT_EQ(PAGE_SIZE, res);
+                                                  completed++;
+                                              }});
+        }
+        backend->submit(std::move(requests));
+        while (completed.load() < num_pages) {
+            std::this_thread::yield();
+        }
+
+        // 一批读请求，最后一个请求越过文件末尾，只能读到部分数据
+        completed = 0;
+        std::vector<ssize_t> results(num_pages + 1, -1);
+        char tail_buf[PAGE_SIZE];
+        for (int i = 0; i <= num_pages; i++) {
+            char *buf = i < num_pages ? read_buf.data() + i * PAGE_SIZE : tail_buf;
+            requests.push_back(AsyncIoRequest{fd, i, buf, PAGE_SIZE, false, [&completed, &results, i](ssize_t res) {
+                                                  results[i] = res;
+                                                  completed++;
+                                              }});
+        }
+        backend->submit(std::move(requests));
+        while (completed.load() <= num_pages) {
+            std::this_thread::yield();
+        }
+        for (int i = 0; i < num_pages; i++) {
+            EXPECT_EQ(PAGE_SIZE, results[i]);
+        }
+        EXPECT_EQ(0, results[num_pages]);
+        EXPECT_EQ(0, memcmp(write_buf.data(), read_buf.data(), write_buf.size()));
+    }
+
+    // DiskManager的同步批量接口
+    char buf[PAGE_SIZE];
+    std::vector<AsyncIoRequest> requests;
+    requests.push_back(AsyncIoRequest{fd, 0, buf, PAGE_SIZE, false, nullptr});
+    disk_manager_->submit_and_wait(std::move(requests));
+    requests.clear();
+    requests.push_back(AsyncIoRequest{fd, num_pages, buf, PAGE_SIZE, false, nullptr});
+    EXPECT_THROW(disk_manager_->submit_and_wait(std::move(requests)), InternalError);
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 多个线程同时向队列深度很小的后端提交大批请求，SQ被其他线程填满、提交需要重试时所有请求仍然完成
+ */
+TEST_F(DiskManagerTest, AsyncIoConcurrentSubmit) {
+    const int num_threads = 4;
+    const int num_pages = 256;
+    const std::string filename = "AsyncIoConcurrentTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+
+    std::unique_ptr<AsyncIo> backend = AsyncIo::create(4);
+    std::vector<char> write_buf(num_threads * num_pages * PAGE_SIZE);
+    rand_buf(write_buf.data(), write_buf.size());
+    std::atomic<int> failed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            std::atomic<int> completed{0};
+            std::vector<AsyncIoRequest> requests;
+            for (int i = t * num_pages; i < (t + 1) * num_pages; i++) {
+                requests.push_back(AsyncIoRequest{fd, i, write_buf.data() + static_cast<size_t>(i) * PAGE_SIZE,
+                                                  PAGE_SIZE, true, [&](ssize_t res) {
+                                                      if (res != PAGE_SIZE) failed++;
+                                                      completed++;
+                                                  }});
+            }
+            backend->submit(std::move(requests));
+            // 提交线程退出时内核会取消它提交的io_uring请求，等待完成后再退出
+            while (completed.load() < num_pages) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, failed.load());
+    std::vector<char> read_buf(write_buf.size());
+    for (int i = 0; i < num_threads * num_pages; i++) {
+        disk_manager_->read_page(fd, i, read_buf.data() + static_cast<size_t>(i) * PAGE_SIZE, PAGE_SIZE);
+    }
+    EXPECT_EQ(0, memcmp(write_buf.data(), read_buf.data(), write_buf.size()));
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief O_DIRECT模式下对齐的页面直接读写，不对齐的读写(如文件头)通过临时缓冲区中转，且不覆盖页面的其余部分
+ */
+TEST_F(DiskManagerTest, DirectIo) {
+    const int num_pages = 8;
+    const std::string filename = "DirectIoTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename, true);
+    std::cout << "O_DIRECT " << (disk_manager_->is_direct_io(fd) ? "enabled" : "not supported") << std::endl;
+
+    PageArena arena(num_pages + 1, false);
+    char *read_buf = arena.get_page(num_pages);
+    for (int i = 0; i < num_pages; i++) {
+        rand_buf(arena.get_page(i), PAGE_SIZE);
+        disk_manager_->write_page(fd, i, arena.get_page(i), PAGE_SIZE);
+    }
+    for (int i = 0; i < num_pages; i++) {
+        disk_manager_->read_page(fd, i, read_buf, PAGE_SIZE);
+        EXPECT_EQ(0, memcmp(arena.get_page(i), read_buf, PAGE_SIZE));
+    }
+
+    // 不对齐的部分页写入只覆盖前hdr_size个字节
+    const int hdr_size = 100;
+    char hdr[hdr_size + 1];
+    rand_buf(hdr + 1, hdr_size);
+    disk_manager_->write_page(fd, 0, hdr + 1, hdr_size);
+    char unaligned[PAGE_SIZE + 1];
+    disk_manager_->read_page(fd, 0, unaligned + 1, PAGE_SIZE);
+    EXPECT_EQ(0, memcmp(hdr + 1, unaligned + 1, hdr_size));
+    EXPECT_EQ(0, memcmp(arena.get_page(0) + hdr_size, unaligned + 1 + hdr_size, PAGE_SIZE - hdr_size));
+    disk_manager_->read_page(fd, 0, unaligned + 1, hdr_size);
+    EXPECT_EQ(0, memcmp(hdr + 1, unaligned + 1, hdr_size));
+
+    // 异步批量读写使用缓冲池中对齐的帧
+    std::vector<AsyncIoRequest> requests;
+    for (int i = 0; i < num_pages; i++) {
+        requests.push_back(AsyncIoRequest{fd, i, arena.get_page(i), PAGE_SIZE, false, nullptr});
+    }
+    disk_manager_->submit_and_wait(std::move(requests));
+    EXPECT_EQ(0, memcmp(hdr + 1, arena.get_page(0), hdr_size));
+
+    EXPECT_THROW(disk_manager_->read_page(fd, num_pages, read_buf, PAGE_SIZE), InternalError);
+    disk_manager_->close_file(fd);
+    EXPECT_EQ(false, disk_manager_->is_direct_io(fd));
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 释放的页面优先被重新分配；关闭文件时保存空闲页面列表，重新打开后继续复用；收缩文件截断末尾的空闲页面
+ */
+TEST_F(DiskManagerTest, FreePageTest) {
+    const int num_pages = 10;
+    const std::string filename = "FreePageTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < num_pages; i++) {
+        EXPECT_EQ(i, disk_manager_->allocate_page(fd));
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+
+    disk_manager_->deallocate_page(fd, 7);
+    disk_manager_->deallocate_page(fd, 3);
+    EXPECT_EQ(2, disk_manager_->get_num_free_pages(fd));
+    EXPECT_EQ(3, disk_manager_->allocate_page(fd));
+    // 空闲列表跨越关闭和重新打开
+    disk_manager_->close_file(fd);
+    EXPECT_TRUE(disk_manager_->is_file(filename + DiskManager::FREE_LIST_SUFFIX));
+    fd = disk_manager_->open_file(filename);
+    disk_manager_->set_fd2pageno(fd, num_pages);
+    EXPECT_EQ(1, disk_manager_->get_num_free_pages(fd));
+    EXPECT_EQ(7, disk_manager_->allocate_page(fd));
+    EXPECT_EQ(num_pages, disk_manager_->allocate_page(fd));
+    disk_manager_->write_page(fd, num_pages, buf, PAGE_SIZE);
+
+    // 回滚时取回被释放的页面
+    disk_manager_->deallocate_page(fd, 5);
+    EXPECT_TRUE(disk_manager_->reclaim_page(fd, 5));
+    EXPECT_FALSE(disk_manager_->reclaim_page(fd, 5));
+
+    // 末尾连续的空闲页面被截断，中间的空闲页面保留
+    disk_manager_->deallocate_page(fd, 2);
+    disk_manager_->deallocate_page(fd, num_pages);
+    disk_manager_->deallocate_page(fd, num_pages - 1);
+    EXPECT_EQ(2, disk_manager_->shrink_file(fd));
+    EXPECT_EQ(num_pages - 1, disk_manager_->get_fd2pageno(fd));
+    EXPECT_EQ((num_pages - 1) * PAGE_SIZE, disk_manager_->get_file_size(filename));
+    EXPECT_EQ(1, disk_manager_->get_num_free_pages(fd));
+    EXPECT_EQ(0, disk_manager_->shrink_file(fd));
+    EXPECT_EQ(2, disk_manager_->allocate_page(fd));
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+    EXPECT_FALSE(disk_manager_->is_file(filename + DiskManager::FREE_LIST_SUFFIX));
+}
+
+/**
+ * @brief 多个线程并发打开和关闭同一组文件，同一时刻每个文件只能被打开一次；文件表记录每个文件的读写统计
+ */
+TEST_F(DiskManagerTest, FileTableTest) {
+    const int num_files = 4;
+    const int num_threads = 8;
+    const int num_rounds = 200;
+    std::vector<std::string> filenames;
+    for (int i = 0; i < num_files; i++) {
+        filenames.push_back("FileTableTestFile" + std::to_string(i));
+        if (disk_manager_->is_file(filenames[i])) {
+            disk_manager_->destroy_file(filenames[i]);
+        }
+        disk_manager_->create_file(filenames[i]);
+    }
+
+    std::atomic<int> open_count[num_files]{};
+    std::atomic<bool> duplicate{false};
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([&, tid]() {
+            for (int round = 0; round < num_rounds; round++) {
+                int i = (tid + round) % num_files;
+                int fd;
+                try {
+                    fd = disk_manager_->open_file(filenames[i]);
+                } catch (FileNotClosedError &) {
+                    continue;
+                }
+                if (open_count[i].fetch_add(1) != 0) {
+                    duplicate = true;
+                }
+                if (disk_manager_->get_file_name(fd) != filenames[i] || disk_manager_->get_file_fd(filenames[i]) != fd) {
+                    duplicate = true;
+                }
+                open_count[i].fetch_sub(1);
+                disk_manager_->close_file(fd);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(duplicate);
+
+    int fd = disk_manager_->open_file(filenames[0]);
+    char buf[PAGE_SIZE] = {0};
+    for (int i = 0; i < 3; i++) {
+        disk_manager_->write_page(fd, i, buf, PAGE_SIZE);
+    }
+    disk_manager_->read_page(fd, 1, buf, PAGE_SIZE);
+    FileIoStats stats = disk_manager_->get_file_io_stats(fd);
+    EXPECT_EQ(3, stats.num_writes);
+    EXPECT_EQ(3 * PAGE_SIZE, stats.bytes_written);
+    EXPECT_EQ(1, stats.num_reads);
+    EXPECT_EQ(PAGE_SIZE, stats.bytes_read);
+    // 重新打开文件时统计和已分配的页面个数清零
+    disk_manager_->close_file(fd);
+    fd = disk_manager_->open_file(filenames[0]);
+    EXPECT_EQ(0, disk_manager_->get_file_io_stats(fd).num_writes);
+    EXPECT_EQ(0, disk_manager_->get_fd2pageno(fd));
+    disk_manager_->close_file(fd);
+    EXPECT_THROW(disk_manager_->close_file(fd), FileNotOpenError);
+
+    for (auto &filename : filenames) {
+        disk_manager_->destroy_file(filename);
+    }
+}
+
+/**
+ * @brief 多个线程并发读写时，文件和全局的I/O统计都不丢失计数；异步请求在完成后计入统计
+ */
+TEST_F(DiskManagerTest, IoStatsTest) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.percentile_us(0.5));
+    for (uint64_t us : {0, 1, 3, 5, 100, 100, 100, 100, 100, 1000000}) {
+        histogram.record(us);
+    }
+    EXPECT_EQ(10, histogram.count());
+    EXPECT_EQ(1000509, histogram.sum_us());
+    EXPECT_EQ(128, histogram.percentile_us(0.5));           // 100位于[64, 128)
+    EXPECT_EQ(1 << 20, histogram.percentile_us(0.99));      // 1000000位于[2^19, 2^20)
+
+    const std::string filename = "IoStatsTest.txt";
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    FileIoStats before = disk_manager_->get_total_io_stats();
+    uint64_t reads_before = disk_manager_->get_io_stats().read_latency.count();
+
+    const int num_threads = 4;
+    const int ops_per_thread = 100;
+    std::vector<std::thread> threads;
+    for (int tid = 0; tid < num_threads; tid++) {
+        threads.emplace_back([this, fd, tid]() {
+            char buf[PAGE_SIZE] = {0};
+            for (int i = 0; i < ops_per_thread; i++) {
+                disk_manager_->write_page(fd, tid, buf, PAGE_SIZE);
+                disk_manager_->read_page(fd, tid, buf, PAGE_SIZE);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::vector<char> bufs(2 * PAGE_SIZE);
+    std::vector<AsyncIoRequest> requests;
+    requests.push_back(AsyncIoRequest{fd, 0, bufs.data(), PAGE_SIZE, false, nullptr});
+    requests.push_back(AsyncIoRequest{fd, 1, bufs.data() + PAGE_SIZE, PAGE_SIZE, false, nullptr});
+    disk_manager_->submit_and_wait(std::move(requests));
+
+    const uint64_t num_ops = num_threads * ops_per_thread;
+    FileIoStats stats = disk_manager_->get_file_io_stats(fd);
+    EXPECT_EQ(num_ops, stats.num_writes);
+    EXPECT_EQ(num_ops * PAGE_SIZE, stats.bytes_written);
+    EXPECT_EQ(num_ops + 2, stats.num_reads);
+    EXPECT_EQ((num_ops + 2) * PAGE_SIZE, stats.bytes_read);
+    FileIoStats total = disk_manager_->get_total_io_stats();
+    EXPECT_EQ(num_ops, total.num_writes - before.num_writes);
+    EXPECT_EQ(num_ops + 2, total.num_reads - before.num_reads);
+    EXPECT_EQ(num_ops + 2, disk_manager_->get_io_stats().read_latency.count() - reads_before);
+    std::vector<std::pair<int, std::string>> open_files = {{fd, filename}};
+    EXPECT_EQ(open_files, disk_manager_->list_open_files());
+
+    disk_manager_->close_file(fd);
+    EXPECT_TRUE(disk_manager_->list_open_files().empty());
+    // 文件关闭之后仍然计入全局统计
+    EXPECT_EQ(num_ops, disk_manager_->get_total_io_stats().num_writes - before.num_writes);
+    disk_manager_->destroy_file(filename);
+}
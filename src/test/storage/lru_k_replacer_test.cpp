@@ -0,0 +1,273 @@
+#include "replacer/lru_k_replacer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief 简单测试LRUKReplacer的基本功能(k=2)
+ */
+TEST(LRUKReplacerTest, SimpleTest) {
+    LRUKReplacer lru_k_replacer(7, 2);
+
+    // Scenario: access frames 1..6 once, then access 1 again so it has two references.
+    for (int i = 1; i <= 6; i++) {
+        lru_k_replacer.pin(i);
+    }
+    lru_k_replacer.pin(1);
+    for (int i = 1; i <= 6; i++) {
+        lru_k_replacer.unpin(i);
+    }
+    EXPECT_EQ(6, lru_k_replacer.Size());
+
+    // Scenario: frames with fewer than k references are evicted first, oldest first access first.
+    int value;
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(2, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(3, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(4, value);
+
+    // Scenario: access 5 again, it now has k references and is kept longer than 6.
+    lru_k_replacer.pin(5);
+    EXPECT_EQ(2, lru_k_replacer.Size());
+    lru_k_replacer.unpin(5);
+
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(6, value);
+    // Both 1 and 5 have two references; 1's second most recent access is older.
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(1, value);
+    lru_k_replacer.victim(&value);
+    EXPECT_EQ(5, value);
+    EXPECT_EQ(0, lru_k_replacer.Size());
+    EXPECT_EQ(false, lru_k_replacer.victim(&value));
+}
+
+/**
+ * @brief 顺序扫描只访问一次的页面不会把多次访问的热点页面挤出缓冲池
+ */
+TEST(LRUKReplacerTest, ScanResistanceTest) {
+    const int num_frames = 100;
+    const int num_hot = 10;
+    LRUKReplacer lru_k_replacer(num_frames, 2);
+
+    // 热点frame被访问两次
+    for (int r = 0; r < 2; r++) {
+        for (int i = 0; i < num_hot; i++) {
+            lru_k_replacer.pin(i);
+            lru_k_replacer.unpin(i);
+        }
+    }
+    // 其余frame被一次顺序扫描访问，之后被反复淘汰、复用
+    for (int i = num_hot; i < num_frames; i++) {
+        lru_k_replacer.pin(i);
+        lru_k_replacer.unpin(i);
+    }
+    int value;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(true, lru_k_replacer.victim(&value));
+        EXPECT_GE(value, num_hot);
+        lru_k_replacer.pin(value);
+        lru_k_replacer.unpin(value);
+    }
+
+    // 移除frame后其访问历史被清空
+    lru_k_replacer.remove(0);
+    EXPECT_EQ(num_frames - 1, lru_k_replacer.Size());
+    lru_k_replacer.pin(0);
+    lru_k_replacer.unpin(0);
+    lru_k_replacer.victim(&value);
+    EXPECT_GE(value, num_hot);
+}
+
+/**
+ * @brief 并发测试LRUKReplacer
+ */
+TEST(LRUKReplacerTest, ConcurrencyTest) {
+    const int num_threads = 5;
+    const int num_runs = 50;
+    for (int run = 0; run < num_runs; run++) {
+        int value_size = 1000;
+        std::shared_ptr<LRUKReplacer> lru_k_replacer{new LRUKReplacer(value_size, 2)};
+        std::vector<std::thread> threads;
+        int result;
+        std::vector<int> value(value_size);
+        for (int i = 0; i < value_size; i++) {
+            value[i] = i;
+        }
+        auto rng = std::default_random_engine{};
+        std::shuffle(value.begin(), value.end(), rng);
+
+        for (int tid = 0; tid < num_threads; tid++) {
+            threads.push_back(std::thread([tid, &lru_k_replacer, &value]() {
+                int share = 1000 / 5;
+                for (int i = 0; i < share; i++) {
+                    lru_k_replacer->pin(value[tid * share + i]);
+                    lru_k_replacer->unpin(value[tid * share + i]);
+                }
+            }));
+        }
+        for (int i = 0; i < num_threads; i++) {
+            threads[i].join();
+        }
+
+        std::vector<int> out_values;
+        for (int i = 0; i < value_size; i++) {
+            EXPECT_EQ(1, lru_k_replacer->victim(&result));
+            out_values.push_back(result);
+        }
+        std::sort(out_values.begin(), out_values.end());
+        for (int i = 0; i < value_size; i++) {
+            EXPECT_EQ(i, out_values[i]);
+        }
+        EXPECT_EQ(false, lru_k_replacer->victim(&result));
+    }
+}
+
+/**
+ * @brief eviction_candidates按照淘汰顺序列出frame，且不改变replacer的状态
+ */
+TEST(LRUKReplacerTest, EvictionCandidatesTest) {
+    LRUKReplacer lru_k_replacer(6, 2);
+    for (int i = 0; i < 6; i++) {
+        lru_k_replacer.pin(i);
+    }
+    // 0和3被访问了两次，排在只被访问一次的frame之后；0的倒数第2次访问更早，先于3被淘汰
+    lru_k_replacer.pin(3);
+    lru_k_replacer.pin(0);
+    for (int i = 0; i < 6; i++) {
+        lru_k_replacer.unpin(i);
+    }
+    std::vector<frame_id_t> expected = {1, 2, 4, 5, 0, 3};
+    EXPECT_EQ(std::vector<frame_id_t>({1, 2, 4}), lru_k_replacer.eviction_candidates(3));
+    EXPECT_EQ(expected, lru_k_replacer.eviction_candidates(10));
+    EXPECT_EQ(6, lru_k_replacer.Size());
+    int value;
+    for (frame_id_t frame_id : expected) {
+        EXPECT_EQ(true, lru_k_replacer.victim(&value));
+        EXPECT_EQ(frame_id, value);
+    }
+    EXPECT_EQ(true, lru_k_replacer.eviction_candidates(10).empty());
+}
+
+/**
+ * @brief record_access补记的访问与pin记录的访问一样计入历史，且不改变frame是否可以被淘汰
+ */
+TEST(LRUKReplacerTest, RecordAccessTest) {
+    LRUKReplacer lru_k_replacer(4, 2);
+    for (int i = 0; i < 4; i++) {
+        lru_k_replacer.unpin(i);
+    }
+    // frame 0补记两次访问后访问达到k次，最后被淘汰；不可淘汰的frame 1补记访问后仍不可淘汰
+    lru_k_replacer.record_access(0, 2);
+    lru_k_replacer.pin(1);
+    lru_k_replacer.record_access(1, 5);
+    lru_k_replacer.record_access(2, 0);
+    EXPECT_EQ(3, lru_k_replacer.Size());
+    EXPECT_EQ(std::vector<frame_id_t>({2, 3, 0}), lru_k_replacer.eviction_candidates(4));
+    lru_k_replacer.unpin(1);
+    int value;
+    EXPECT_EQ(true, lru_k_replacer.victim(&value));
+    EXPECT_EQ(2, value);
+    EXPECT_EQ(true, lru_k_replacer.victim(&value));
+    EXPECT_EQ(3, value);
+    // frame 0的倒数第2次访问早于frame 1
+    EXPECT_EQ(true, lru_k_replacer.victim(&value));
+    EXPECT_EQ(0, value);
+}
+
+TEST(LRUKReplacerTest, ResizeTest) {
+    LRUKReplacer lru_k_replacer(2, 2);
+    // 超出容量的frame被忽略
+    lru_k_replacer.unpin(3);
+    EXPECT_EQ(0, lru_k_replacer.Size());
+    // frame 0被访问两次，扩容后保留访问历史
+    lru_k_replacer.pin(0);
+    lru_k_replacer.pin(0);
+    lru_k_replacer.unpin(0);
+    lru_k_replacer.resize(4);
+    lru_k_replacer.unpin(3);
+    EXPECT_EQ(2, lru_k_replacer.Size());
+    int value;
+    EXPECT_EQ(true, lru_k_replacer.victim(&value));
+    EXPECT_EQ(3, value);
+    EXPECT_EQ(true, lru_k_replacer.victim(&value));
+    EXPECT_EQ(0, value);
+}
+
+/**
+ * @brief 随机地pin、unpin、remove之后，淘汰顺序与按定义逐个比较所有frame得到的顺序相同
+ */
+TEST(LRUKReplacerTest, RandomizedOrderTest) {
+    const int num_frames = 64;
+    const size_t k = 3;
+    LRUKReplacer lru_k_replacer(num_frames, k);
+    // 参考模型：每个frame的全部访问时间戳和是否可以被淘汰
+    std::vector<std::vector<uint64_t>> accesses(num_frames);
+    std::vector<bool> evictable(num_frames, false);
+    uint64_t ts = 0;
+    auto expected_victim = [&]() {
+        int best = -1;
+        std::pair<bool, uint64_t> best_key;
+        for (int f = 0; f < num_frames; f++) {
+            if (!evictable[f]) {
+                continue;
+            }
+            bool inf = accesses[f].size() < k;
+            uint64_t key = inf ? accesses[f].front() : accesses[f][accesses[f].size() - k];
+            std::pair<bool, uint64_t> f_key{!inf, key};
+            if (best == -1 || f_key < best_key) {
+                best = f;
+                best_key = f_key;
+            }
+        }
+        return best;
+    };
+    std::mt19937 rng(2024);
+    for (int op = 0; op < 20000; op++) {
+        int f = static_cast<int>(rng() % num_frames);
+        switch (rng() % 8) {
+            case 0:
+            case 1:
+            case 2:
+                lru_k_replacer.pin(f);
+                accesses[f].push_back(++ts);
+                evictable[f] = false;
+                break;
+            case 3:
+            case 4:
+            case 5:
+                lru_k_replacer.unpin(f);
+                if (!evictable[f] && accesses[f].empty()) {
+                    accesses[f].push_back(++ts);
+                }
+                evictable[f] = true;
+                break;
+            case 6:
+                lru_k_replacer.remove(f);
+                accesses[f].clear();
+                evictable[f] = false;
+                break;
+            default: {
+                int expected = expected_victim();
+                std::vector<frame_id_t> candidates = lru_k_replacer.eviction_candidates(4);
+                int value = -1;
+                ASSERT_EQ(expected != -1, lru_k_replacer.victim(&value));
+                if (expected != -1) {
+                    ASSERT_EQ(expected, value);
+                    ASSERT_EQ(expected, candidates.front());
+                    accesses[value].clear();
+                    evictable[value] = false;
+                }
+            }
+        }
+        ASSERT_EQ(static_cast<size_t>(std::count(evictable.begin(), evictable.end(), true)), lru_k_replacer.Size());
+    }
+}
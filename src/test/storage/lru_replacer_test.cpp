@@ -155,3 +155,26 @@ TEST(LRUReplacerTest, ConcurrencyTest) {
         EXPECT_EQ(0, lru_replacer->victim(&result));
     }
 }
+
+/**
+ * @brief eviction_candidates按照淘汰顺序列出frame，且不改变replacer的状态
+ */
+TEST(LRUReplacerTest, EvictionCandidatesTest) {
+    LRUReplacer lru_replacer(5);
+    for (int i = 0; i < 5; i++) {
+        lru_replacer.unpin(i);
+    }
+    // 再次访问1，1成为最近被访问的frame
+    lru_replacer.pin(1);
+    lru_replacer.unpin(1);
+    std::vector<frame_id_t> expected = {0, 2, 3, 4, 1};
+    EXPECT_EQ(std::vector<frame_id_t>({0, 2}), lru_replacer.eviction_candidates(2));
+    EXPECT_EQ(expected, lru_replacer.eviction_candidates(10));
+    EXPECT_EQ(5, lru_replacer.Size());
+    int value;
+    for (frame_id_t frame_id : expected) {
+        EXPECT_EQ(true, lru_replacer.victim(&value));
+        EXPECT_EQ(frame_id, value);
+    }
+    EXPECT_EQ(true, lru_replacer.eviction_candidates(10).empty());
+}
@@ -4,11 +4,19 @@
 #include "record/rm.h"
 #undef private  // for use private variables in "rm.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <ctime>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <set>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "gtest/gtest.h"
 #define BUFFER_LENGTH 8192
@@ -38,6 +46,8 @@ void check_equal(const RmFileHandle *file_handle,
         auto mock_buf = (char *)entry.second.c_str();
         auto rec = file_handle->get_record(rid, context);
         assert(memcmp(mock_buf, rec->data, file_handle->file_hdr_.record_size) == 0);
+        auto view = file_handle->get_record_view(rid, context);
+        assert(memcmp(mock_buf, view.data(), file_handle->file_hdr_.record_size) == 0);
     }
     // Randomly get record
     for (int i = 0; i < 10; i++) {
@@ -96,7 +106,7 @@ TEST(RecordManagerTest, SimpleTest) {
         std::unique_ptr<RmFileHandle> file_handle = rm_manager->open_file(filename);
         // 检查filename文件在内存中的file header的参数
         assert(file_handle->file_hdr_.record_size == record_size);
-        assert(file_handle->file_hdr_.first_free_page_no == RM_NO_PAGE);
+        assert(file_handle->fsm_.find_free_page(RM_FIRST_RECORD_PAGE, RM_NO_PAGE, INT32_MAX) == RM_NO_PAGE);
         assert(file_handle->file_hdr_.num_pages == 1);
 
         int max_bytes = file_handle->file_hdr_.record_size * file_handle->file_hdr_.num_records_per_page +
@@ -202,7 +212,7 @@ TEST(RecordManagerTest, MultipleFilesTest) {
         std::unique_ptr<RmFileHandle> file_handle = rm_manager->open_file(filename);
         // 检查filename文件在内存中的file header的参数
         assert(file_handle->file_hdr_.record_size == record_size);
-        assert(file_handle->file_hdr_.first_free_page_no == RM_NO_PAGE);
+        assert(file_handle->fsm_.find_free_page(RM_FIRST_RECORD_PAGE, RM_NO_PAGE, INT32_MAX) == RM_NO_PAGE);
         // printf("file_handle->file_hdr_.num_pages=%d\n", file_handle->file_hdr_.num_pages);
         assert(file_handle->file_hdr_.num_pages == 1);
 
@@ -223,4 +233,1044 @@ TEST(RecordManagerTest, MultipleFilesTest) {
         std::string filename = filenames[i];
         rm_manager->destroy_file(filename);
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief 记录全部被删除的页面被释放，之后插入记录时复用这些页面，文件不再增长；关闭文件时截断末尾的空闲页面
+ */
+TEST(RecordManagerTest, FreePageReuseTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "free_page.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    rm_manager->create_file(filename, 400);
+    auto file_handle = rm_manager->open_file(filename);
+    int per_page = file_handle->file_hdr_.num_records_per_page;
+    const int num_data_pages = 8;
+
+    char write_buf[PAGE_SIZE];
+    std::vector<Rid> rids;
+    for (int i = 0; i < per_page * num_data_pages; i++) {
+        rand_buf(file_handle->file_hdr_.record_size, write_buf);
+        rids.push_back(file_handle->insert_record(write_buf, context));
+    }
+    EXPECT_EQ(num_data_pages + 1, file_handle->file_hdr_.num_pages);
+
+    // 删除所有记录，每个页面变空时被释放
+    for (auto &rid : rids) {
+        file_handle->delete_record(rid, context);
+    }
+    EXPECT_EQ(num_data_pages, disk_manager->get_num_free_pages(file_handle->GetFd()));
+    EXPECT_EQ(RM_NO_PAGE, file_handle->fsm_.find_free_page(RM_FIRST_RECORD_PAGE, RM_NO_PAGE,
+                                                            file_handle->file_hdr_.num_pages));
+    EXPECT_EQ(true, RmScan(file_handle.get()).is_end());
+
+    // 回滚删除：在被释放的页面上重新插入记录
+    file_handle->insert_record(rids[0], write_buf);
+    EXPECT_EQ(true, file_handle->is_record(rids[0]));
+    EXPECT_TRUE(file_handle->fsm_.is_free(rids[0].page_no));
+    file_handle->delete_record(rids[0], context);
+
+    // 再次插入时复用被释放的页面
+    rids.clear();
+    for (int i = 0; i < per_page * (num_data_pages / 2); i++) {
+        rand_buf(file_handle->file_hdr_.record_size, write_buf);
+        rids.push_back(file_handle->insert_record(write_buf, context));
+    }
+    EXPECT_EQ(num_data_pages + 1, file_handle->file_hdr_.num_pages);
+    for (auto &rid : rids) {
+        EXPECT_LE(rid.page_no, num_data_pages / 2);
+    }
+
+    // 空闲空间映射中过时的空闲标记在插入时被清除，记录插入其他页面
+    file_handle->fsm_.set_free(RM_FIRST_RECORD_PAGE, true);
+    rand_buf(file_handle->file_hdr_.record_size, write_buf);
+    Rid extra = file_handle->insert_record(write_buf, context);
+    EXPECT_NE(RM_FIRST_RECORD_PAGE, extra.page_no);
+    EXPECT_FALSE(file_handle->fsm_.is_free(RM_FIRST_RECORD_PAGE));
+    file_handle->delete_record(extra, context);
+
+    // 关闭文件时截断末尾的空闲页面
+    rm_manager->close_file(file_handle.get());
+    EXPECT_EQ((num_data_pages / 2 + 1) * PAGE_SIZE, disk_manager->get_file_size(filename));
+    file_handle = rm_manager->open_file(filename);
+    EXPECT_EQ(num_data_pages / 2 + 1, file_handle->file_hdr_.num_pages);
+    size_t num_records = 0;
+    for (RmScan scan(file_handle.get()); !scan.is_end(); scan.next()) {
+        num_records++;
+    }
+    EXPECT_EQ(rids.size(), num_records);
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 多个线程并发插入时使用各自的插入目标页面，所有记录都能读出，空闲空间映射与页面的实际状态一致
+ */
+TEST(RecordManagerTest, ConcurrentInsertTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "concurrent_insert.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // 同时并发维护页面摘要
+    rm_manager->create_file(filename, 100, RM_FORMAT_BITMAP, {}, {{0, 4, TYPE_INT}});
+    auto file_handle = rm_manager->open_file(filename);
+    int record_size = file_handle->file_hdr_.record_size;
+
+    const int num_threads = 8;
+    const int num_records = 2000;
+    std::vector<std::vector<Rid>> rids(num_threads);
+    std::vector<std::vector<char>> bufs(num_threads, std::vector<char>(num_records * record_size));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            char result[BUFFER_LENGTH];
+            int offset = 0;
+            Context context(nullptr, nullptr, nullptr, result, &offset);
+            for (int i = 0; i < num_records; i++) {
+                char *buf = bufs[t].data() + i * record_size;
+                memset(buf, 0, record_size);
+                memcpy(buf, &t, sizeof(t));
+                memcpy(buf + sizeof(t), &i, sizeof(i));
+                rids[t].push_back(file_handle->insert_record(buf, &context));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    std::set<int> first_pages;
+    for (int t = 0; t < num_threads; t++) {
+        first_pages.insert(rids[t].front().page_no);
+        for (int i = 0; i < num_records; i++) {
+            EXPECT_EQ(0, mock.count(rids[t][i]));
+            mock[rids[t][i]] = std::string(bufs[t].data() + i * record_size, record_size);
+        }
+    }
+    // 线程不会都挤在同一个页面上
+    EXPECT_LT(1, static_cast<int>(first_pages.size()));
+    check_equal(file_handle.get(), mock);
+    for (int page_no = RM_FIRST_RECORD_PAGE; page_no < file_handle->file_hdr_.num_pages; page_no++) {
+        RmPageHandle page_handle = file_handle->fetch_page_handle(page_no);
+        EXPECT_EQ(!file_handle->is_page_full(page_handle), file_handle->fsm_.is_free(page_no)) << page_no;
+        buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+    }
+
+    // 重新打开后空闲空间映射保持不变，新的插入继续使用未满的页面
+    int num_pages = file_handle->file_hdr_.num_pages;
+    rm_manager->close_file(file_handle.get());
+    file_handle = rm_manager->open_file(filename);
+    check_equal(file_handle.get(), mock);
+    int free_page_no = file_handle->fsm_.find_free_page(RM_FIRST_RECORD_PAGE, RM_NO_PAGE, num_pages);
+    if (free_page_no != RM_NO_PAGE) {
+        char result[BUFFER_LENGTH];
+        int offset = 0;
+        Context context(nullptr, nullptr, nullptr, result, &offset);
+        char buf[PAGE_SIZE] = {};
+        EXPECT_EQ(num_pages, file_handle->file_hdr_.num_pages);
+        file_handle->insert_record(buf, &context);
+        EXPECT_EQ(num_pages, file_handle->file_hdr_.num_pages);
+    }
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 记录视图直接指向缓冲池页面中的slot，在生命周期内持有页面的固定和读锁，释放或移动后不再持有
+ */
+TEST(RecordManagerTest, RecordViewTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "record_view.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    rm_manager->create_file(filename, 64);
+    auto file_handle = rm_manager->open_file(filename);
+
+    char write_buf[PAGE_SIZE];
+    rand_buf(file_handle->file_hdr_.record_size, write_buf);
+    Rid rid = file_handle->insert_record(write_buf, context);
+
+    RmPageHandle page_handle = file_handle->fetch_page_handle(rid.page_no);
+    Page *page = page_handle.page;
+    EXPECT_EQ(1, page->pin_count_);
+    {
+        RecordView view = file_handle->get_record_view(rid, context);
+        EXPECT_EQ(true, view.is_valid());
+        EXPECT_EQ(file_handle->file_hdr_.record_size, view.size());
+        EXPECT_EQ(page_handle.get_slot(rid.slot_no), view.data());
+        EXPECT_EQ(0, memcmp(write_buf, view.data(), view.size()));
+        EXPECT_EQ(2, page->pin_count_);
+        // 视图持有读锁，写锁无法获取，读锁可以共享
+        EXPECT_EQ(false, page->latch_->try_lock());
+        EXPECT_EQ(true, page->latch_->try_lock_shared());
+        page->latch_->unlock_shared();
+
+        // 物化出的记录与页面无关
+        auto rec = view.to_record();
+        EXPECT_NE(view.data(), rec->data);
+        EXPECT_EQ(0, memcmp(write_buf, rec->data, rec->size));
+
+        RecordView moved = std::move(view);
+        EXPECT_EQ(false, view.is_valid());
+        EXPECT_EQ(true, moved.is_valid());
+        EXPECT_EQ(2, page->pin_count_);
+        moved.release();
+        EXPECT_EQ(false, moved.is_valid());
+        EXPECT_EQ(1, page->pin_count_);
+        EXPECT_EQ(true, page->latch_->try_lock());
+        page->latch_->unlock();
+
+        RecordView scoped = file_handle->get_record_view(rid, context);
+        EXPECT_EQ(2, page->pin_count_);
+    }
+    EXPECT_EQ(1, page->pin_count_);
+    buffer_pool_manager->unpin_page(page->get_page_id(), false);
+
+    // 记录不存在时抛出异常，且不会遗留页面固定
+    file_handle->delete_record(rid, context);
+    EXPECT_THROW(file_handle->get_record_view(rid, context), RecordNotFoundError);
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+// 生成slotted格式测试用的定长记录：定长部分是随机字节，变长字段是随机长度的非0字符，剩余部分补0
+void rand_var_buf(const RmFileHdr &hdr, int max_var_len, char *out_buf) {
+    rand_buf(hdr.record_size, out_buf);
+    for (int i = 0; i < hdr.num_var_cols; i++) {
+        const RmVarCol &col = hdr.var_cols[i];
+        int len = rand() % (std::min<int>(max_var_len, col.len) + 1);
+        for (int j = 0; j < col.len; j++) {
+            out_buf[col.offset + j] = j < len ? static_cast<char>('a' + rand() % 26) : 0;
+        }
+    }
+}
+
+/**
+ * @brief slotted格式的表：VARCHAR字段只存储实际长度，随机插入、变长更新、删除和回滚删除后记录、扫描与mock一致；
+ * 更新后原页面放不下的记录被移到其他页面，Rid保持不变，扫描只在原位置返回一次
+ */
+TEST(RecordManagerTest, SlottedPageTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "slotted.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // int a, varchar(200) b, char(8) c, varchar(50) d
+    std::vector<RmVarCol> var_cols = {{212, 50}, {4, 200}};
+    rm_manager->create_file(filename, 262, RM_FORMAT_SLOTTED, var_cols);
+    auto file_handle = rm_manager->open_file(filename);
+    ASSERT_EQ(RM_FORMAT_SLOTTED, file_handle->file_hdr_.format);
+    ASSERT_EQ(2, file_handle->file_hdr_.num_var_cols);
+    EXPECT_EQ(4, file_handle->file_hdr_.var_cols[0].offset);
+
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    char write_buf[PAGE_SIZE];
+    int record_size = file_handle->file_hdr_.record_size;
+    // 短字符串：页面能存放的记录数远多于按最大长度存储
+    for (int i = 0; i < 2000; i++) {
+        rand_var_buf(file_handle->file_hdr_, 16, write_buf);
+        Rid rid = file_handle->insert_record(write_buf, context);
+        mock[rid] = std::string(write_buf, record_size);
+    }
+    check_equal(file_handle.get(), mock);
+    int fixed_per_page = (PAGE_SIZE - 16) / (record_size + 1);
+    EXPECT_LT(file_handle->file_hdr_.num_pages - 1, 2000 / fixed_per_page / 3);
+
+    // 把同一个页面上的记录都更新为最长的记录，页面放不下的记录被移走
+    int page_no = RM_FIRST_RECORD_PAGE;
+    std::vector<Rid> page_rids;
+    for (auto &entry : mock) {
+        if (entry.first.page_no == page_no) {
+            page_rids.push_back(entry.first);
+        }
+    }
+    for (auto &rid : page_rids) {
+        rand_var_buf(file_handle->file_hdr_, 250, write_buf);
+        memset(write_buf + 4, 'x', 200);
+        memset(write_buf + 212, 'y', 50);
+        file_handle->update_record(rid, write_buf, context);
+        mock[rid] = std::string(write_buf, record_size);
+    }
+    auto count_forward = [&]() {
+        RmPageHandle page_handle = file_handle->fetch_page_handle(page_no);
+        RmSlottedPage page = page_handle.slotted();
+        int num_forward = 0;
+        for (int i = 0; i < page.num_slots(); i++) {
+            if (page.is_used(i) && (page.get_flags(i) & RM_SLOT_FORWARD)) {
+                num_forward++;
+            }
+        }
+        buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+        return num_forward;
+    };
+    EXPECT_GT(count_forward(), 0);
+    check_equal(file_handle.get(), mock);
+    // 再改回短记录，记录移回原页面
+    for (auto &rid : page_rids) {
+        rand_var_buf(file_handle->file_hdr_, 4, write_buf);
+        file_handle->update_record(rid, write_buf, context);
+        mock[rid] = std::string(write_buf, record_size);
+    }
+    EXPECT_EQ(0, count_forward());
+    check_equal(file_handle.get(), mock);
+
+    for (int round = 0; round < 3000; round++) {
+        auto it = mock.begin();
+        std::advance(it, rand() % mock.size());
+        Rid rid = it->first;
+        int dice = rand() % 4;
+        if (dice == 0) {
+            // 变长更新，长记录可能被移到其他页面
+            rand_var_buf(file_handle->file_hdr_, rand() % 2 == 0 ? 16 : 250, write_buf);
+            file_handle->update_record(rid, write_buf, context);
+            mock[rid] = std::string(write_buf, record_size);
+        } else if (dice == 1) {
+            file_handle->delete_record(rid, context);
+            EXPECT_EQ(false, file_handle->is_record(rid));
+            if (rand() % 2 == 0) {
+                // 回滚删除：在原位置重新插入
+                file_handle->insert_record(rid, const_cast<char *>(it->second.data()));
+            } else {
+                mock.erase(rid);
+            }
+        } else {
+            rand_var_buf(file_handle->file_hdr_, rand() % 2 == 0 ? 16 : 250, write_buf);
+            Rid new_rid = file_handle->insert_record(write_buf, context);
+            ASSERT_EQ(0u, mock.count(new_rid));
+            mock[new_rid] = std::string(write_buf, record_size);
+        }
+        if (round % 500 == 0) {
+            rm_manager->close_file(file_handle.get());
+            file_handle = rm_manager->open_file(filename);
+        }
+    }
+    check_equal(file_handle.get(), mock);
+
+    // 全部删除后页面被释放
+    for (auto &entry : mock) {
+        file_handle->delete_record(entry.first, context);
+    }
+    mock.clear();
+    EXPECT_EQ(true, RmScan(file_handle.get()).is_end());
+    EXPECT_EQ(file_handle->file_hdr_.num_pages - 1, disk_manager->get_num_free_pages(file_handle->GetFd()));
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief slotted格式中互相转发的两条记录（r1从页面A转发到B，r2从B转发到A）被两个线程并发更新时不会死锁，
+ * 原页面放不下新记录，每次更新都要同时持有两个页面的写锁
+ */
+TEST(RecordManagerTest, CrossForwardUpdateTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "cross_forward.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // int a, varchar(250) b
+    rm_manager->create_file(filename, 254, RM_FORMAT_SLOTTED, {{4, 250}});
+    auto file_handle = rm_manager->open_file(filename);
+    int record_size = file_handle->file_hdr_.record_size;
+    auto make_record = [&](int key, int var_len, char c, char *out) {
+        memset(out, 0, record_size);
+        memcpy(out, &key, sizeof(int));
+        memset(out + 4, c, var_len);
+    };
+
+    // 1. 插入空字符串的短记录，直到前两个数据页面都被插满
+    char buf[PAGE_SIZE];
+    Rid r1{RM_NO_PAGE, -1};
+    Rid r2{RM_NO_PAGE, -1};
+    for (int i = 0; file_handle->get_num_pages() <= RM_FIRST_RECORD_PAGE + 2; i++) {
+        make_record(i, 0, 0, buf);
+        Rid rid = file_handle->insert_record(buf, nullptr);
+        if (rid.page_no == RM_FIRST_RECORD_PAGE && r1.page_no == RM_NO_PAGE) {
+            r1 = rid;
+        } else if (rid.page_no == RM_FIRST_RECORD_PAGE + 1 && r2.page_no == RM_NO_PAGE) {
+            r2 = rid;
+        }
+    }
+    ASSERT_NE(RM_NO_PAGE, r2.page_no);
+
+    // 2. 把r1移到r2的页面、r2移到r1的页面，原位置只保留转发的Rid；之后两个页面都放不下一条长记录
+    auto forward = [&](const Rid &rid, int target_page_no, char c) {
+        make_record(0, 200, c, buf);
+        char moved[RM_MAX_SLOTTED_TUPLE];
+        memcpy(moved, &rid, sizeof(Rid));
+        int len = file_handle->encode_record(buf, moved + sizeof(Rid)) + static_cast<int>(sizeof(Rid));
+        WritePageGuard home = file_handle->fetch_page_write(rid.page_no);
+        WritePageGuard target_guard = file_handle->fetch_page_write(target_page_no);
+        Rid target{target_page_no, RmSlottedPage(target_guard.get_data_mut()).insert(moved, len, RM_SLOT_MOVED)};
+        ASSERT_GE(target.slot_no, 0);
+        ASSERT_EQ(true, RmSlottedPage(home.get_data_mut())
+                            .update(rid.slot_no, reinterpret_cast<const char *>(&target), sizeof(Rid), RM_SLOT_FORWARD));
+    };
+    forward(r1, r2.page_no, 'a');
+    forward(r2, r1.page_no, 'b');
+    auto is_forward = [&](const Rid &rid) {
+        ReadPageGuard guard = file_handle->fetch_page_read(rid.page_no);
+        RmSlottedPage page(const_cast<char *>(guard.get_data()));
+        return (page.get_flags(rid.slot_no) & RM_SLOT_FORWARD) != 0;
+    };
+    ASSERT_EQ(true, is_forward(r1));
+    ASSERT_EQ(true, is_forward(r2));
+
+    // 3. 两个线程反复更新各自的记录，同样长度的新记录只能在转发到的页面上原地更新
+    const int num_updates = 200000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; t++) {
+        threads.emplace_back([&, t]() {
+            Rid rid = t == 0 ? r1 : r2;
+            char rec[PAGE_SIZE];
+            for (int i = 0; i < num_updates; i++) {
+                make_record(t, 200, static_cast<char>('a' + i % 26), rec);
+                file_handle->update_record(rid, rec, nullptr);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < 2; t++) {
+        Rid rid = t == 0 ? r1 : r2;
+        make_record(t, 200, static_cast<char>('a' + (num_updates - 1) % 26), buf);
+        EXPECT_EQ(0, memcmp(buf, file_handle->get_record(rid, nullptr)->data, record_size));
+        EXPECT_EQ(true, is_forward(rid));
+    }
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief slotted格式的表：读取被转发的记录时，并发的更新把记录移回原页面或移到别处、其他记录的插入和删除复用
+ * 新位置上的槽，读者总是读到该记录某个完整的版本，不会读到其他记录
+ */
+TEST(RecordManagerTest, ForwardReadRaceTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "forward_read_race.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // int a, varchar(250) b
+    rm_manager->create_file(filename, 254, RM_FORMAT_SLOTTED, {{4, 250}});
+    auto file_handle = rm_manager->open_file(filename);
+    int record_size = file_handle->file_hdr_.record_size;
+    auto make_record = [&](int key, int var_len, char c, char *out) {
+        memset(out, 0, record_size);
+        memcpy(out, &key, sizeof(int));
+        memset(out + 4, c, var_len);
+    };
+
+    // 1. 插入空字符串的短记录直到第一个数据页面被插满，之后其中的记录变长时只能转发到其他页面
+    const int num_writers = 2;
+    char buf[PAGE_SIZE];
+    std::vector<Rid> rids;
+    for (int i = 0; file_handle->get_num_pages() <= RM_FIRST_RECORD_PAGE + 1; i++) {
+        make_record(i, 0, 0, buf);
+        Rid rid = file_handle->insert_record(buf, nullptr);
+        if (rid.page_no == RM_FIRST_RECORD_PAGE && static_cast<int>(rids.size()) < num_writers) {
+            rids.push_back(rid);
+        }
+    }
+    ASSERT_EQ(num_writers, static_cast<int>(rids.size()));
+
+    // 2. 写者交替把记录更新为长记录（转发）和短记录（移回原页面并删除新位置）；另一个线程反复插入和删除其他记录，
+    // 复用被删除的槽；读者检查读到的记录属于要读的Rid并且是完整的一个版本
+    const int num_updates = 500000;
+    std::atomic<bool> done{false};
+    std::atomic<int> num_bad{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_writers; t++) {
+        threads.emplace_back([&, t]() {
+            char rec[PAGE_SIZE];
+            int key;
+            memcpy(&key, file_handle->get_record(rids[t], nullptr)->data, sizeof(int));
+            for (int i = 0; i < num_updates; i++) {
+                make_record(key, i % 2 == 0 ? 200 : 0, static_cast<char>('a' + i % 26), rec);
+                file_handle->update_record(rids[t], rec, nullptr);
+            }
+        });
+    }
+    std::thread churn([&]() {
+        char rec[PAGE_SIZE];
+        make_record(-1, 200, 'z', rec);
+        while (!done) {
+            Rid rid = file_handle->insert_record(rec, nullptr);
+            file_handle->delete_record(rid, nullptr);
+        }
+    });
+    std::vector<std::thread> readers;
+    for (int t = 0; t < num_writers; t++) {
+        readers.emplace_back([&, t]() {
+            int key;
+            memcpy(&key, file_handle->get_record(rids[t], nullptr)->data, sizeof(int));
+            while (!done) {
+                auto record = file_handle->get_record(rids[t], nullptr);
+                int cur_key;
+                memcpy(&cur_key, record->data, sizeof(int));
+                char c = record->data[4];
+                int var_len = c == 0 ? 0 : 200;
+                bool ok = cur_key == key && (c == 0 || (c >= 'a' && c <= 'z'));
+                for (int j = 0; ok && j < 250; j++) {
+                    ok = record->data[4 + j] == (j < var_len ? c : 0);
+                }
+                if (!ok) {
+                    num_bad++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    done = true;
+    churn.join();
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0, num_bad.load());
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief PAX格式的表：每个字段的值存放在各自的minipage中，随机插入、更新、删除和回滚删除后记录、扫描与mock一致；
+ * 只读取部分字段时其他字段不被改写，页面容量与bitmap格式相同
+ */
+TEST(RecordManagerTest, PaxPageTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "pax.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // int a, char(100) b, float c, char(20) d，乱序传入
+    std::vector<RmVarCol> cols = {{108, 20}, {0, 4}, {104, 4}, {4, 100}};
+    EXPECT_THROW(rm_manager->create_file(filename, 300, RM_FORMAT_PAX, std::vector<RmVarCol>(RM_MAX_PAX_COLS + 1)),
+                 TooManyColumnsError);
+    rm_manager->create_file(filename, 128, RM_FORMAT_PAX, cols);
+    auto file_handle = rm_manager->open_file(filename);
+    const RmFileHdr &hdr = file_handle->file_hdr_;
+    ASSERT_EQ(RM_FORMAT_PAX, hdr.format);
+    ASSERT_EQ(4, hdr.num_pax_cols);
+    EXPECT_EQ(4, hdr.pax_cols[1].offset);
+    EXPECT_EQ(108, hdr.pax_cols[3].offset);
+    int hdr_size = Page::OFFSET_PAGE_HDR + sizeof(RmPageHdr);
+    EXPECT_EQ((BITMAP_WIDTH * (PAGE_SIZE - 1 - hdr_size) + 1) / (1 + 128 * BITMAP_WIDTH), hdr.num_records_per_page);
+
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    char write_buf[PAGE_SIZE];
+    for (int i = 0; i < 1000; i++) {
+        rand_buf(hdr.record_size, write_buf);
+        Rid rid = file_handle->insert_record(write_buf, context);
+        mock[rid] = std::string(write_buf, hdr.record_size);
+    }
+    check_equal(file_handle.get(), mock);
+
+    // 同一字段的值在minipage中连续存放
+    Rid first = RmScan(file_handle.get()).rid();
+    {
+        RmPageHandle page_handle = file_handle->fetch_page_handle(first.page_no);
+        for (int slot_no = 0; slot_no < 3; slot_no++) {
+            const std::string &rec = mock.at(Rid{first.page_no, slot_no});
+            const RmVarCol &col = hdr.pax_cols[3];
+            EXPECT_EQ(page_handle.slots + hdr.num_records_per_page * 108 + slot_no * 20,
+                      page_handle.get_pax_value(slot_no, col));
+            EXPECT_EQ(0, memcmp(rec.data() + 108, page_handle.get_pax_value(slot_no, col), 20));
+        }
+        buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+    }
+
+    // 只读取部分字段
+    char read_buf[128];
+    memset(read_buf, 0x5a, sizeof(read_buf));
+    file_handle->get_record_cols(first, {{0, 4}, {104, 4}}, read_buf);
+    const std::string &first_rec = mock.at(first);
+    EXPECT_EQ(0, memcmp(first_rec.data(), read_buf, 4));
+    EXPECT_EQ(0, memcmp(first_rec.data() + 104, read_buf + 104, 4));
+    EXPECT_EQ(std::string(100, 0x5a), std::string(read_buf + 4, 100));
+    EXPECT_EQ(std::string(20, 0x5a), std::string(read_buf + 108, 20));
+
+    // 随机更新、删除和回滚删除
+    for (int i = 0; i < 1000; i++) {
+        auto it = mock.begin();
+        std::advance(it, rand() % mock.size());
+        Rid rid = it->first;
+        if (rand() % 2 == 0) {
+            rand_buf(hdr.record_size, write_buf);
+            file_handle->update_record(rid, write_buf, context);
+            mock[rid] = std::string(write_buf, hdr.record_size);
+        } else {
+            std::string rec = it->second;
+            file_handle->delete_record(rid, context);
+            mock.erase(rid);
+            if (rand() % 4 == 0) {
+                file_handle->insert_record(rid, rec.data());
+                mock[rid] = rec;
+            }
+        }
+    }
+    check_equal(file_handle.get(), mock);
+
+    // 重新打开后记录不变
+    rm_manager->close_file(file_handle.get());
+    file_handle = rm_manager->open_file(filename);
+    check_equal(file_handle.get(), mock);
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 批量插入的记录与逐条插入一样可以读出和扫描到，按顺序填满空闲页面，不会多占用页面；bitmap和slotted格式都适用
+ */
+TEST(RecordManagerTest, BatchInsertTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    for (RmFileFormat format : {RM_FORMAT_BITMAP, RM_FORMAT_SLOTTED}) {
+        std::string filename = "batch_insert.txt";
+        if (disk_manager->is_file(filename)) {
+            disk_manager->destroy_file(filename);
+        }
+        rm_manager->create_file(filename, 400, format, {{100, 200}});
+        auto file_handle = rm_manager->open_file(filename);
+        int record_size = file_handle->file_hdr_.record_size;
+        std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+
+        char write_buf[PAGE_SIZE];
+        for (int i = 0; i < 3; i++) {
+            rand_var_buf(file_handle->file_hdr_, 200, write_buf);
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, record_size);
+        }
+        int num_pages = file_handle->file_hdr_.num_pages;
+
+        const int num_records = 100;
+        std::vector<char> bufs(num_records * record_size);
+        for (int i = 0; i < num_records; i++) {
+            rand_var_buf(file_handle->file_hdr_, 200, bufs.data() + i * record_size);
+        }
+        std::vector<Rid> rids;
+        file_handle->insert_records(bufs.data(), num_records, &rids, context);
+        ASSERT_EQ(num_records, static_cast<int>(rids.size()));
+        // 先填满已有的空闲页面，再依次使用新页面
+        EXPECT_EQ(num_pages - 1, rids.front().page_no);
+        for (int i = 0; i < num_records; i++) {
+            EXPECT_EQ(0, mock.count(rids[i]));
+            mock[rids[i]] = std::string(bufs.data() + i * record_size, record_size);
+            if (i > 0) {
+                EXPECT_LE(rids[i - 1].page_no, rids[i].page_no);
+            }
+        }
+        // 除最后一个页面外，批量插入用到的页面都已插满
+        for (int page_no = rids.front().page_no; page_no < rids.back().page_no; page_no++) {
+            RmPageHandle page_handle = file_handle->fetch_page_handle(page_no);
+            bool is_full = format == RM_FORMAT_SLOTTED
+                               ? !page_handle.slotted().has_room(record_size + 2 + sizeof(Rid))
+                               : page_handle.page_hdr->num_records == file_handle->file_hdr_.num_records_per_page;
+            EXPECT_TRUE(is_full);
+            buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+        }
+        // 最后一个页面可能恰好被插满，空闲空间映射与页面的实际状态一致
+        RmPageHandle last_handle = file_handle->fetch_page_handle(rids.back().page_no);
+        EXPECT_EQ(!file_handle->is_page_full(last_handle), file_handle->fsm_.is_free(rids.back().page_no));
+        buffer_pool_manager->unpin_page(last_handle.page->get_page_id(), false);
+        check_equal(file_handle.get(), mock);
+
+        // 重新打开后记录不变
+        rm_manager->close_file(file_handle.get());
+        file_handle = rm_manager->open_file(filename);
+        check_equal(file_handle.get(), mock);
+        rm_manager->close_file(file_handle.get());
+        rm_manager->destroy_file(filename);
+    }
+}
+
+/**
+ * @brief 页面摘要覆盖页面中所有的记录：带条件的扫描跳过不满足条件的页面，不会漏掉满足条件的记录；
+ *        更新、删除、回滚删除和重新打开文件之后仍然成立；bitmap和slotted格式都适用
+ */
+TEST(RecordManagerTest, ZoneMapTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    // int ts, char(8) name, char(100) payload，payload太长，不维护页面摘要
+    std::vector<RmZoneCol> zone_cols = {{0, 4, TYPE_INT}, {4, 8, TYPE_STRING}, {12, 100, TYPE_STRING}};
+    for (RmFileFormat format : {RM_FORMAT_BITMAP, RM_FORMAT_SLOTTED}) {
+        std::string filename = "zone_map.txt";
+        if (disk_manager->is_file(filename)) {
+            disk_manager->destroy_file(filename);
+        }
+        rm_manager->create_file(filename, 112, format, {{12, 100}}, zone_cols);
+        auto file_handle = rm_manager->open_file(filename);
+        ASSERT_EQ(2, file_handle->file_hdr_.num_zone_cols);
+        EXPECT_EQ(4, file_handle->file_hdr_.zone_cols[1].offset);
+        EXPECT_TRUE(disk_manager->is_file(RmManager::get_zone_map_file_name(filename)));
+
+        std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+        char write_buf[PAGE_SIZE];
+        auto make_record = [&](int ts) {
+            rand_var_buf(file_handle->file_hdr_, 100, write_buf);
+            memcpy(write_buf, &ts, sizeof(int));
+            memcpy(write_buf + 4, "name", 5);
+        };
+        const int num_records = 3000;
+        for (int ts = 0; ts < num_records; ts++) {
+            make_record(ts);
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, 112);
+        }
+
+        // 扫描返回所有满足条件的记录，返回的记录数不超过预期的上界，说明不满足条件的页面被跳过
+        auto check_scan = [&](const std::vector<RmZonePred> &preds, const std::function<bool(const char *)> &pred,
+                              size_t max_scanned) {
+            std::unordered_set<Rid, rid_hash_t, rid_equal_t> scanned;
+            for (RmScan scan(file_handle.get(), preds); !scan.is_end(); scan.next()) {
+                scanned.insert(scan.rid());
+            }
+            for (auto &entry : mock) {
+                if (pred(entry.second.data())) {
+                    EXPECT_EQ(1, scanned.count(entry.first));
+                }
+            }
+            EXPECT_LE(scanned.size(), max_scanned);
+        };
+        auto ts_of = [](const char *rec) { return *reinterpret_cast<const int *>(rec); };
+
+        int bound = num_records - 100;
+        std::vector<RmZonePred> ts_gt = {{0, OP_GT, reinterpret_cast<const char *>(&bound)}};
+        check_scan(ts_gt, [&](const char *rec) { return ts_of(rec) > bound; }, 200);
+        int low = 10;
+        std::vector<RmZonePred> ts_le = {{0, OP_LE, reinterpret_cast<const char *>(&low)}};
+        check_scan(ts_le, [&](const char *rec) { return ts_of(rec) <= low; }, 100);
+        char other[8] = "other";
+        check_scan({{1, OP_EQ, other}}, [](const char *) { return false; }, 0);
+        check_scan({}, [](const char *) { return true; }, mock.size());
+
+        // 把前面页面中的记录更新为很大的值，扫描仍然能找到它们
+        for (int i = 0; i < 20; i++) {
+            auto it = mock.begin();
+            std::advance(it, rand() % mock.size());
+            make_record(num_records + i);
+            file_handle->update_record(it->first, write_buf, context);
+            it->second = std::string(write_buf, 112);
+        }
+        check_scan(ts_gt, [&](const char *rec) { return ts_of(rec) > bound; }, mock.size());
+        // 随机删除和回滚删除
+        for (int i = 0; i < 1000; i++) {
+            auto it = mock.begin();
+            std::advance(it, rand() % mock.size());
+            Rid rid = it->first;
+            std::string rec = it->second;
+            file_handle->delete_record(rid, context);
+            mock.erase(rid);
+            if (rand() % 4 == 0) {
+                rec[0] = static_cast<char>(rand());  // 修改ts的低字节
+                file_handle->insert_record(rid, rec.data());
+                mock[rid] = rec;
+            }
+        }
+        for (int i = 0; i < 100; i++) {
+            make_record(rand() % (2 * num_records));
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, 112);
+        }
+        check_equal(file_handle.get(), mock);
+        check_scan(ts_gt, [&](const char *rec) { return ts_of(rec) > bound; }, mock.size());
+        check_scan(ts_le, [&](const char *rec) { return ts_of(rec) <= low; }, mock.size());
+
+        // 重新打开后页面摘要仍然有效
+        rm_manager->close_file(file_handle.get());
+        file_handle = rm_manager->open_file(filename);
+        check_scan(ts_gt, [&](const char *rec) { return ts_of(rec) > bound; }, mock.size());
+        size_t num_le = 0;
+        for (RmScan scan(file_handle.get(), ts_le); !scan.is_end(); scan.next()) {
+            num_le++;
+        }
+        EXPECT_LT(num_le, mock.size() / 2);
+        rm_manager->close_file(file_handle.get());
+        rm_manager->destroy_file(filename);
+        EXPECT_FALSE(disk_manager->is_file(RmManager::get_zone_map_file_name(filename)));
+    }
+}
+
+/**
+ * @brief 页面摘要不写日志。模拟数据页面已经写回、摘要页面还是旧版本、文件没有正常关闭的故障，
+ *        重新打开时摘要全部作废，扫描不会跳过被更新的页面；正常关闭之后再打开，作废的摘要不会被当作有效
+ */
+TEST(RecordManagerTest, ZoneMapUncleanShutdownTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "zone_map_crash.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    std::string zm_filename = RmManager::get_zone_map_file_name(filename);
+    // int ts, char(60) payload
+    rm_manager->create_file(filename, 64, RM_FORMAT_BITMAP, {}, {{0, 4, TYPE_INT}});
+    auto file_handle = rm_manager->open_file(filename);
+    char buf[64] = {};
+    std::vector<Rid> rids;
+    const int num_records = 3000;
+    for (int ts = 0; ts < num_records; ts++) {
+        memcpy(buf, &ts, sizeof(int));
+        rids.push_back(file_handle->insert_record(buf, nullptr));
+    }
+    rm_manager->close_file(file_handle.get());
+    auto read_file = [](const std::string &name) {
+        std::ifstream in(name, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    };
+    std::string stale_zone_map = read_file(zm_filename);
+
+    // 把第一个页面中的一条记录更新为很大的值，正常关闭后摘要覆盖它
+    file_handle = rm_manager->open_file(filename);
+    int big = 2 * num_records;
+    memcpy(buf, &big, sizeof(int));
+    file_handle->update_record(rids[0], buf, nullptr);
+    rm_manager->close_file(file_handle.get());
+
+    // 模拟故障：摘要文件恢复为更新之前的版本，文件头停留在打开期间的状态
+    {
+        std::ofstream out(zm_filename, std::ios::binary | std::ios::trunc);
+        out << stale_zone_map;
+    }
+    int fd = disk_manager->open_file(filename);
+    RmFileHdr file_hdr;
+    disk_manager->read_page(fd, RM_FILE_HDR_PAGE, reinterpret_cast<char *>(&file_hdr), sizeof(file_hdr));
+    file_hdr.is_clean = 0;
+    disk_manager->write_page(fd, RM_FILE_HDR_PAGE, reinterpret_cast<char *>(&file_hdr), sizeof(file_hdr));
+    disk_manager->close_file(fd);
+
+    // 重启：新的缓冲池中没有旧的摘要页面
+    auto count_gt = [&](RmManager *manager) {
+        auto handle = manager->open_file(filename);
+        int bound = num_records;
+        std::vector<RmZonePred> preds = {{0, OP_GT, reinterpret_cast<const char *>(&bound)}};
+        std::vector<Rid> found;
+        for (RmScan scan(handle.get(), preds); !scan.is_end(); scan.next()) {
+            if (*reinterpret_cast<int *>(handle->get_record(scan.rid(), nullptr)->data) > bound) {
+                found.push_back(scan.rid());
+            }
+        }
+        manager->close_file(handle.get());
+        return found;
+    };
+    for (int restart = 0; restart < 2; restart++) {
+        auto restarted_bpm = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+        auto restarted_rm = std::make_unique<RmManager>(disk_manager.get(), restarted_bpm.get());
+        std::vector<Rid> found = count_gt(restarted_rm.get());
+        ASSERT_EQ(1u, found.size());
+        EXPECT_EQ(rids[0], found[0]);
+    }
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief VACUUM把文件末尾页面中的记录移到前面的空闲空间中并截断文件：记录内容不变，回调给出的新旧Rid与实际位置一致，
+ *        整理期间并发的顺序扫描每次都恰好返回所有记录一次；bitmap、slotted和PAX格式都适用
+ */
+TEST(RecordManagerTest, VacuumTest) {
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    for (RmFileFormat format : {RM_FORMAT_BITMAP, RM_FORMAT_SLOTTED, RM_FORMAT_PAX}) {
+        std::string filename = "vacuum.txt";
+        if (disk_manager->is_file(filename)) {
+            disk_manager->destroy_file(filename);
+        }
+        // int a, varchar(200) b, char(96) c
+        std::vector<RmVarCol> cols = format == RM_FORMAT_PAX ? std::vector<RmVarCol>{{0, 4}, {4, 200}, {204, 96}}
+                                                             : std::vector<RmVarCol>{{4, 200}};
+        rm_manager->create_file(filename, 300, format, cols);
+        auto file_handle = rm_manager->open_file(filename);
+        int record_size = file_handle->file_hdr_.record_size;
+
+        std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+        char write_buf[PAGE_SIZE];
+        for (int i = 0; i < 3000; i++) {
+            rand_var_buf(file_handle->file_hdr_, 100, write_buf);
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, record_size);
+        }
+        // 前一半页面中的记录全部删除，页面被释放；其余页面中的记录删除大部分
+        int num_pages = file_handle->file_hdr_.num_pages;
+        for (auto it = mock.begin(); it != mock.end();) {
+            if (it->first.page_no < num_pages / 2 || rand() % 4 != 0) {
+                file_handle->delete_record(it->first, context);
+                it = mock.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (format == RM_FORMAT_SLOTTED) {
+            // 变长记录变长后被移到其他页面，原位置只保留转发的Rid
+            for (int i = 0; i < 50; i++) {
+                auto it = mock.begin();
+                std::advance(it, rand() % mock.size());
+                rand_var_buf(file_handle->file_hdr_, 200, write_buf);
+                memset(write_buf + 4, 'x', 200);
+                file_handle->update_record(it->first, write_buf, context);
+                it->second = std::string(write_buf, record_size);
+            }
+        }
+        check_equal(file_handle.get(), mock);
+
+        size_t num_records = mock.size();
+        std::atomic<bool> stop{false};
+        std::atomic<int> num_scans{0};
+        std::thread reader([&]() {
+            while (!stop) {
+                std::unordered_set<Rid, rid_hash_t, rid_equal_t> scanned;
+                size_t num_scanned = 0;
+                for (RmScan scan(file_handle.get()); !scan.is_end(); scan.next()) {
+                    scanned.insert(scan.rid());
+                    num_scanned++;
+                }
+                EXPECT_EQ(num_records, num_scanned);
+                EXPECT_EQ(num_scanned, scanned.size());
+                num_scans++;
+            }
+        });
+        while (num_scans == 0) {
+            std::this_thread::yield();
+        }
+        int num_moved = file_handle->vacuum([&](const Rid &old_rid, const Rid &new_rid, const char *record) {
+            auto it = mock.find(old_rid);
+            ASSERT_NE(mock.end(), it);
+            EXPECT_EQ(0, memcmp(it->second.data(), record, record_size));
+            std::string rec = it->second;
+            mock.erase(it);
+            EXPECT_EQ(0, mock.count(new_rid));
+            mock[new_rid] = rec;
+        });
+        for (int scans = num_scans; num_scans < scans + 2;) {
+            std::this_thread::yield();
+        }
+        stop = true;
+        reader.join();
+        // 记录总是移到页号最小的空闲位置，不会被移动两次
+        EXPECT_GT(num_moved, 0);
+        EXPECT_LE(num_moved, static_cast<int>(num_records));
+        EXPECT_LT(file_handle->file_hdr_.num_pages, num_pages / 2);
+        check_equal(file_handle.get(), mock);
+        if (format != RM_FORMAT_SLOTTED) {
+            // 除最后一个页面外都已插满
+            int num_full_pages = static_cast<int>(mock.size()) / file_handle->file_hdr_.num_records_per_page;
+            EXPECT_LE(file_handle->file_hdr_.num_pages, RM_FIRST_RECORD_PAGE + num_full_pages + 1);
+        }
+        // 文件末尾被清空的页面已经截断，再次整理没有记录可以移动
+        rm_manager->flush_file(file_handle.get());
+        EXPECT_EQ(file_handle->file_hdr_.num_pages, disk_manager->get_file_size(filename) / PAGE_SIZE);
+        EXPECT_EQ(0, file_handle->vacuum([](const Rid &, const Rid &, const char *) {}));
+
+        // 重新打开后记录不变
+        rm_manager->close_file(file_handle.get());
+        file_handle = rm_manager->open_file(filename);
+        check_equal(file_handle.get(), mock);
+        rm_manager->close_file(file_handle.get());
+        rm_manager->destroy_file(filename);
+    }
+}
+
+/**
+ * @brief 按字扫描和AVX2跳块的next_bit与逐位扫描的结果一致，包括长度不是8的倍数和目标位只在末尾的情况
+ */
+TEST(RecordManagerTest, BitmapNextBitTest) {
+    auto naive_next_bit = [](bool bit, const char *bm, int max_n, int curr) {
+        for (int i = curr + 1; i < max_n; i++) {
+            if (Bitmap::is_set(bm, i) == bit) {
+                return i;
+            }
+        }
+        return max_n;
+    };
+    srand(0);
+    char bm[512];
+    for (int max_n : {1, 7, 8, 63, 64, 65, 300, 1000, 4000}) {
+        int size = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        for (int density : {0, 1, 50, 99, 100}) {
+            Bitmap::init(bm, size);
+            for (int i = 0; i < max_n; i++) {
+                if (rand() % 100 < density) {
+                    Bitmap::set(bm, i);
+                }
+            }
+            // max_n之后的填充位保持为0，与页面中的bitmap相同
+            for (bool bit : {false, true}) {
+                for (int curr = -1; curr < max_n; curr++) {
+                    ASSERT_EQ(naive_next_bit(bit, bm, max_n, curr), Bitmap::next_bit(bit, bm, max_n, curr))
+                        << "max_n=" << max_n << " density=" << density << " bit=" << bit << " curr=" << curr;
+                }
+            }
+        }
+        // 只有最后一位不同，需要跳过所有的块
+        Bitmap::init(bm, size);
+        Bitmap::set(bm, max_n - 1);
+        EXPECT_EQ(max_n - 1, Bitmap::first_bit(true, bm, max_n));
+        memset(bm, 0xff, size);
+        Bitmap::reset(bm, max_n - 1);
+        EXPECT_EQ(max_n - 1, Bitmap::first_bit(false, bm, max_n));
+    }
+}
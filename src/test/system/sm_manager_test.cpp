@@ -0,0 +1,305 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "record/rm.h"
+#include "system/sm_manager.h"
+
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+const std::string TEST_DB_NAME = "SmManagerTest_db";
+
+/**
+ * @brief 模拟一次数据库进程：每次创建新的DiskManager和缓冲池，相当于重启之后缓冲池为空
+ */
+struct Instance {
+    std::unique_ptr<DiskManager> disk_manager = std::make_unique<DiskManager>();
+    std::unique_ptr<BufferPoolManager> bpm;
+    std::unique_ptr<RmManager> rm_manager;
+    std::unique_ptr<IxManager> ix_manager;
+    std::unique_ptr<SmManager> sm_manager;
+
+    explicit Instance(size_t pool_size) {
+        bpm = std::make_unique<BufferPoolManager>(pool_size, disk_manager.get(), 4);
+        rm_manager = std::make_unique<RmManager>(disk_manager.get(), bpm.get());
+        ix_manager = std::make_unique<IxManager>(disk_manager.get(), bpm.get());
+        sm_manager = std::make_unique<SmManager>(disk_manager.get(), bpm.get(), rm_manager.get(), ix_manager.get());
+    }
+};
+
+/**
+ * @brief close_db保存缓冲池中的页面列表，open_db在后台把这些页面重新读入缓冲池
+ */
+TEST(SmManagerTest, BufferPoolWarmUpTest) {
+    const size_t pool_size = 64;
+    const int record_size = 500;
+    const int num_records = 800;
+    {
+        Instance db(pool_size);
+        if (db.sm_manager->is_dir(TEST_DB_NAME)) {
+            db.sm_manager->drop_db(TEST_DB_NAME);
+        }
+        db.sm_manager->create_db(TEST_DB_NAME);
+        db.sm_manager->open_db(TEST_DB_NAME);
+        db.sm_manager->create_table("warm", {ColDef{"a", TYPE_STRING, record_size}}, nullptr);
+        RmFileHandle *fh = db.sm_manager->fhs_.at("warm").get();
+        char buf[record_size] = {0};
+        for (int i = 0; i < num_records; i++) {
+            fh->insert_record(buf, nullptr);
+        }
+        ASSERT_GT(fh->get_file_hdr().num_pages, static_cast<int>(pool_size));
+        db.sm_manager->close_db();
+    }
+
+    // 只保存了仍在缓冲池中的页面，包括数据文件和空闲空间映射文件的页面
+    std::set<std::pair<std::string, page_id_t>> dumped;
+    {
+        std::ifstream ifs(TEST_DB_NAME + "/" + BUFFER_POOL_DUMP_NAME);
+        ASSERT_TRUE(ifs.good());
+        std::string name;
+        page_id_t page_no;
+        while (ifs >> name >> page_no) {
+            EXPECT_TRUE(name == "warm" || name == RmManager::get_fsm_file_name("warm")) << name;
+            dumped.insert({name, page_no});
+        }
+    }
+    EXPECT_FALSE(dumped.empty());
+    EXPECT_LE(dumped.size(), pool_size);
+
+    // 重启之后，保存的页面在后台被读入缓冲池
+    {
+        Instance db(pool_size);
+        db.sm_manager->open_db(TEST_DB_NAME);
+        db.bpm->wait_prefetch();
+        RmFileHandle *fh = db.sm_manager->fhs_.at("warm").get();
+        std::set<std::pair<std::string, page_id_t>> resident;
+        for (auto &page_id : db.bpm->get_resident_pages()) {
+            if (page_id.fd == fh->GetFd()) {
+                resident.insert({"warm", page_id.page_no});
+            } else {
+                EXPECT_EQ(fh->get_fsm_fd(), page_id.fd);
+                resident.insert({RmManager::get_fsm_file_name("warm"), page_id.page_no});
+            }
+        }
+        EXPECT_EQ(dumped, resident);
+        db.sm_manager->close_db();
+        db.sm_manager->drop_db(TEST_DB_NAME);
+    }
+}
+
+/**
+ * @brief 有VARCHAR字段的表默认使用slotted格式，STORAGE子句可以显式指定格式，未知的格式和字段过多的PAX表报错；格式在重启后保持不变
+ */
+TEST(SmManagerTest, StorageFormatTest) {
+    {
+        Instance db(64);
+        if (db.sm_manager->is_dir(TEST_DB_NAME)) {
+            db.sm_manager->drop_db(TEST_DB_NAME);
+        }
+        db.sm_manager->create_db(TEST_DB_NAME);
+        db.sm_manager->open_db(TEST_DB_NAME);
+        std::vector<ColDef> var_defs = {ColDef{"id", TYPE_INT, 4}, ColDef{"name", TYPE_VARCHAR, 100},
+                                        ColDef{"tag", TYPE_STRING, 8}, ColDef{"note", TYPE_VARCHAR, 20}};
+        db.sm_manager->create_table("t_var", var_defs, nullptr);
+        db.sm_manager->create_table("t_char", {ColDef{"a", TYPE_STRING, 16}}, nullptr);
+        db.sm_manager->create_table("t_bitmap", var_defs, "bitmap", nullptr);
+        db.sm_manager->create_table("t_slotted", {ColDef{"a", TYPE_INT, 4}}, "SLOTTED", nullptr);
+        db.sm_manager->create_table("t_pax", var_defs, "pax", nullptr);
+        EXPECT_THROW(db.sm_manager->create_table("t_bad", var_defs, "columnar", nullptr), UnknownStorageFormatError);
+        std::vector<ColDef> wide_defs;
+        for (int i = 0; i <= RM_MAX_PAX_COLS; i++) {
+            wide_defs.push_back(ColDef{"c" + std::to_string(i), TYPE_STRING, 1});
+        }
+        EXPECT_THROW(db.sm_manager->create_table("t_wide", wide_defs, "PAX", nullptr), TooManyColumnsError);
+        EXPECT_FALSE(db.sm_manager->db_.is_table("t_wide"));
+
+        const RmFileHdr &hdr = db.sm_manager->fhs_.at("t_var")->get_file_hdr();
+        EXPECT_EQ(RM_FORMAT_SLOTTED, hdr.format);
+        ASSERT_EQ(2, hdr.num_var_cols);
+        EXPECT_EQ(4, hdr.var_cols[0].offset);
+        EXPECT_EQ(100, hdr.var_cols[0].len);
+        EXPECT_EQ(112, hdr.var_cols[1].offset);
+        EXPECT_EQ(RM_FORMAT_BITMAP, db.sm_manager->fhs_.at("t_char")->get_file_hdr().format);
+        EXPECT_EQ(RM_FORMAT_BITMAP, db.sm_manager->fhs_.at("t_bitmap")->get_file_hdr().format);
+        EXPECT_EQ(RM_FORMAT_SLOTTED, db.sm_manager->fhs_.at("t_slotted")->get_file_hdr().format);
+        const RmFileHdr &pax_hdr = db.sm_manager->fhs_.at("t_pax")->get_file_hdr();
+        EXPECT_EQ(RM_FORMAT_PAX, pax_hdr.format);
+        ASSERT_EQ(4, pax_hdr.num_pax_cols);
+        EXPECT_EQ(112, pax_hdr.pax_cols[3].offset);
+        EXPECT_EQ(20, pax_hdr.pax_cols[3].len);
+        EXPECT_EQ(TYPE_VARCHAR, db.sm_manager->db_.get_table("t_var").get_col("name")->type);
+
+        char buf[132] = {0};
+        *reinterpret_cast<int *>(buf) = 7;
+        memcpy(buf + 4, "alice", 5);
+        db.sm_manager->fhs_.at("t_var")->insert_record(buf, nullptr);
+        db.sm_manager->close_db();
+    }
+    {
+        Instance db(64);
+        db.sm_manager->open_db(TEST_DB_NAME);
+        RmFileHandle *fh = db.sm_manager->fhs_.at("t_var").get();
+        EXPECT_EQ(RM_FORMAT_SLOTTED, fh->get_file_hdr().format);
+        EXPECT_EQ(RM_FORMAT_PAX, db.sm_manager->fhs_.at("t_pax")->get_file_hdr().format);
+        EXPECT_EQ(TYPE_VARCHAR, db.sm_manager->db_.get_table("t_var").get_col("note")->type);
+        Rid rid = RmScan(fh).rid();
+        auto rec = fh->get_record(rid, nullptr);
+        EXPECT_EQ(7, *reinterpret_cast<int *>(rec->data));
+        EXPECT_EQ(std::string("alice"), std::string(rec->data + 4));
+        db.sm_manager->close_db();
+        db.sm_manager->drop_db(TEST_DB_NAME);
+    }
+}
+
+/**
+ * @brief LOAD DATA按列的类型解析CSV文件，跳过表头和空行，支持双引号包围的字段；数据跨越多个数据块时保持文件中的顺序；
+ * 出错时报告所在行号，并删除已经导入的记录
+ */
+TEST(SmManagerTest, LoadDataTest) {
+    Instance db(256);
+    if (db.sm_manager->is_dir(TEST_DB_NAME)) {
+        db.sm_manager->drop_db(TEST_DB_NAME);
+    }
+    db.sm_manager->create_db(TEST_DB_NAME);
+    db.sm_manager->open_db(TEST_DB_NAME);
+    db.sm_manager->create_table("t_load", {ColDef{"id", TYPE_INT, 4}, ColDef{"score", TYPE_FLOAT, 4},
+                                           ColDef{"name", TYPE_STRING, 8}, ColDef{"note", TYPE_VARCHAR, 40}},
+                                nullptr);
+    auto note_of = [](int i) { return i % 7 == 0 ? std::string("a, \"quoted\" note") : std::string("plain"); };
+    auto write_rows = [&](std::ofstream &ofs, int num_rows) {
+        for (int i = 0; i < num_rows; i++) {
+            ofs << i << "," << (i % 1000) * 0.5 << ",n" << i % 1000 << ",";
+            if (i % 7 == 0) {
+                ofs << "\"a, \"\"quoted\"\" note\"\r\n";
+            } else {
+                ofs << "plain\n";
+            }
+            if (i == 10) {
+                ofs << "\n";
+            }
+        }
+    };
+
+    const int num_rows = 100000;
+    {
+        std::ofstream ofs("load.csv");
+        ofs << "id,score,name,note\n";
+        write_rows(ofs, num_rows);
+    }
+    EXPECT_EQ(static_cast<size_t>(num_rows), db.sm_manager->load_data("load.csv", "t_load", nullptr));
+
+    RmFileHandle *fh = db.sm_manager->fhs_.at("t_load").get();
+    auto count_rows = [&]() {
+        int count = 0;
+        for (RmScan scan(fh); !scan.is_end(); scan.next()) {
+            count++;
+        }
+        return count;
+    };
+    int i = 0;
+    for (RmScan scan(fh); !scan.is_end(); scan.next(), i++) {
+        auto rec = fh->get_record(scan.rid(), nullptr);
+        ASSERT_EQ(i, *reinterpret_cast<int *>(rec->data));
+        EXPECT_EQ((i % 1000) * 0.5f, *reinterpret_cast<float *>(rec->data + 4));
+        EXPECT_EQ("n" + std::to_string(i % 1000), std::string(rec->data + 8, strnlen(rec->data + 8, 8)));
+        EXPECT_EQ(note_of(i), std::string(rec->data + 16));
+    }
+    EXPECT_EQ(num_rows, i);
+
+    // 导入返回前记录已经写回磁盘
+    char buf[PAGE_SIZE];
+    db.disk_manager->read_page(fh->GetFd(), RM_FILE_HDR_PAGE, buf, PAGE_SIZE);
+    EXPECT_EQ(fh->get_file_hdr().num_pages, reinterpret_cast<RmFileHdr *>(buf)->num_pages);
+
+    // 第50002行的id不是整数，导入失败，前面已经写入的记录被删除
+    {
+        std::ofstream ofs("bad.csv");
+        write_rows(ofs, 50000);
+        ofs << "x,1.0,a,b\n";
+        write_rows(ofs, 10);
+    }
+    try {
+        db.sm_manager->load_data("bad.csv", "t_load", nullptr);
+        ADD_FAILURE() << "LOAD DATA should fail";
+    } catch (LoadDataError &e) {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("line 50002"));
+    }
+    EXPECT_EQ(num_rows, count_rows());
+    EXPECT_THROW(db.sm_manager->load_data("missing.csv", "t_load", nullptr), FileNotFoundError);
+
+    // 有索引的表拒绝导入，不写入任何记录
+    db.sm_manager->create_table("t_load_idx", {ColDef{"id", TYPE_INT, 4}}, nullptr);
+    db.sm_manager->create_index("t_load_idx", {"id"}, nullptr);
+    EXPECT_THROW(db.sm_manager->load_data("load.csv", "t_load_idx", nullptr), LoadIndexedTableError);
+
+    db.sm_manager->close_db();
+    db.sm_manager->drop_db(TEST_DB_NAME);
+}
+
+/**
+ * @brief VACUUM把记录移到文件前面的空闲空间并截断文件；B+树的插入和删除实现之前，有索引的表拒绝整理，记录保持不动
+ */
+TEST(SmManagerTest, VacuumTest) {
+    Instance db(256);
+    if (db.sm_manager->is_dir(TEST_DB_NAME)) {
+        db.sm_manager->drop_db(TEST_DB_NAME);
+    }
+    db.sm_manager->create_db(TEST_DB_NAME);
+    db.sm_manager->open_db(TEST_DB_NAME);
+    for (std::string tab_name : {"t_vac", "t_vac_idx"}) {
+        db.sm_manager->create_table(tab_name, {ColDef{"id", TYPE_INT, 4}, ColDef{"name", TYPE_STRING, 200}}, nullptr);
+        RmFileHandle *fh = db.sm_manager->fhs_.at(tab_name).get();
+        std::vector<char> buf(fh->get_file_hdr().record_size);
+        std::vector<Rid> rids;
+        for (int i = 0; i < 2000; i++) {
+            memcpy(buf.data(), &i, sizeof(int));
+            rids.push_back(fh->insert_record(buf.data(), nullptr));
+        }
+        // 只保留每10条中的一条，后面的页面可以移到前面
+        for (int i = 0; i < 2000; i++) {
+            if (i % 10 != 0) {
+                fh->delete_record(rids[i], nullptr);
+            }
+        }
+    }
+    auto scan_ids = [&](const std::string &tab_name) {
+        std::set<int> ids;
+        RmFileHandle *fh = db.sm_manager->fhs_.at(tab_name).get();
+        for (RmScan scan(fh); !scan.is_end(); scan.next()) {
+            ids.insert(*reinterpret_cast<int *>(fh->get_record(scan.rid(), nullptr)->data));
+        }
+        return ids;
+    };
+    std::set<int> expected;
+    for (int i = 0; i < 2000; i += 10) {
+        expected.insert(i);
+    }
+
+    RmFileHandle *fh = db.sm_manager->fhs_.at("t_vac").get();
+    int num_pages = fh->get_file_hdr().num_pages;
+    EXPECT_GT(db.sm_manager->vacuum_table("t_vac", nullptr), 0);
+    EXPECT_LT(fh->get_file_hdr().num_pages, num_pages);
+    EXPECT_EQ(expected, scan_ids("t_vac"));
+
+    db.sm_manager->create_index("t_vac_idx", {"id"}, nullptr);
+    RmFileHandle *idx_fh = db.sm_manager->fhs_.at("t_vac_idx").get();
+    num_pages = idx_fh->get_file_hdr().num_pages;
+    EXPECT_THROW(db.sm_manager->vacuum_table("t_vac_idx", nullptr), VacuumIndexedTableError);
+    EXPECT_EQ(num_pages, idx_fh->get_file_hdr().num_pages);
+    EXPECT_EQ(expected, scan_ids("t_vac_idx"));
+
+    db.sm_manager->close_db();
+    db.sm_manager->drop_db(TEST_DB_NAME);
+}